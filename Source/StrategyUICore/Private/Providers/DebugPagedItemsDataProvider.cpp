@@ -0,0 +1,118 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Providers/DebugPagedItemsDataProvider.h"
+
+#include "StrategyDebugItem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(DebugPagedItemsDataProvider)
+
+void UDebugPagedItemsDataProvider::BeginDestroy()
+{
+	for (const TPair<int32, FTSTicker::FDelegateHandle>& DelayedFetch : DelayedFetches)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DelayedFetch.Value);
+	}
+	DelayedFetches.Reset();
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UDebugPagedItemsDataProvider::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
+{
+	UObject::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Page boundaries or the count changed, start over
+	Pages.Reset();
+	if (IsValid(DelegateWrapper) && DelegateWrapper->OnDataProviderUpdatedDelegate.IsBound())
+	{
+		DelegateWrapper->OnDataProviderUpdatedDelegate.Broadcast();
+	}
+}
+#endif
+
+void UDebugPagedItemsDataProvider::InitializeDataProvider_Implementation()
+{
+	DelegateWrapper = NewObject<UOnDataProviderUpdatedDelegateWrapper>(this, TEXT("Debug Paged Delegate Wrapper"));
+}
+
+UObject* UDebugPagedItemsDataProvider::GetDataItemAt_Implementation(const int32 Index) const
+{
+	if (Index < 0 || Index >= DebugItemCount)
+	{
+		return nullptr;
+	}
+
+	const FStrategyDebugItemPage* Page = Pages.Find(Index / PageSize);
+	return Page && Page->Items.IsValidIndex(Index % PageSize) ? Page->Items[Index % PageSize].Get() : nullptr;
+}
+
+bool UDebugPagedItemsDataProvider::FetchItemPage_Implementation(const int32 PageIndex, TArray<UObject*>& OutItems)
+{
+	if (SimulatedFetchDelay <= 0.f)
+	{
+		OutItems = ObjectPtrDecay(GetOrCreatePage(PageIndex).Items);
+		return true;
+	}
+
+	if (DelayedFetches.Contains(PageIndex))
+	{
+		return false; // Already on its way
+	}
+
+	TWeakObjectPtr<UDebugPagedItemsDataProvider> WeakThis(this);
+	DelayedFetches.Add(PageIndex, FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([WeakThis, PageIndex](float)
+		{
+			UDebugPagedItemsDataProvider* This = WeakThis.Get();
+			if (!This || !This->DelayedFetches.Remove(PageIndex))
+			{
+				return false;
+			}
+
+			const TArray<UObject*> PageItems = ObjectPtrDecay(This->GetOrCreatePage(PageIndex).Items);
+			if (IsValid(This->DelegateWrapper))
+			{
+				This->DelegateWrapper->OnDataProviderPageLoadedDelegate.Broadcast(PageIndex, PageItems);
+			}
+			return false;
+		}),
+		SimulatedFetchDelay
+	));
+	return false;
+}
+
+void UDebugPagedItemsDataProvider::ReleaseItemPage_Implementation(const int32 PageIndex)
+{
+	if (const FTSTicker::FDelegateHandle* DelayedFetch = DelayedFetches.Find(PageIndex))
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(*DelayedFetch);
+		DelayedFetches.Remove(PageIndex);
+	}
+
+	// Nothing references the page's items once the widget let go of them
+	Pages.Remove(PageIndex);
+}
+
+const FStrategyDebugItemPage& UDebugPagedItemsDataProvider::GetOrCreatePage(const int32 PageIndex)
+{
+	if (const FStrategyDebugItemPage* ExistingPage = Pages.Find(PageIndex))
+	{
+		return *ExistingPage;
+	}
+
+	FStrategyDebugItemPage& NewPage = Pages.Add(PageIndex);
+	const int32 StartIndex = PageIndex * PageSize;
+	const int32 EndIndex = FMath::Min(StartIndex + PageSize, DebugItemCount);
+	NewPage.Items.Reserve(FMath::Max(0, EndIndex - StartIndex));
+
+	for (int32 i = StartIndex; i < EndIndex; ++i)
+	{
+		UStrategyDebugItem* NewItem = NewObject<UStrategyDebugItem>(this, UStrategyDebugItem::StaticClass());
+		NewItem->DebugLabel = FString::Printf(TEXT("Debug Item %d"), i);
+		NewItem->Id = i;
+		NewPage.Items.Add(NewItem);
+	}
+
+	return NewPage;
+}
@@ -0,0 +1,166 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Strategies/BaseLayoutStrategy.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BaseLayoutStrategy)
+
+namespace BaseLayoutStrategy
+{
+	// Most cells per side of the default pick grid
+	static constexpr int32 MaxPickGridDim = 64;
+}
+
+int32 UBaseLayoutStrategy::PickGlobalIndexAtLocalPosition(const FVector2D& LocalPoint, const float PickRadius) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (PickPositions.IsEmpty() || PickRadius <= 0.f)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Entry = PickFromIndex(LocalPoint, PickRadius);
+	return PickGlobalIndices.IsValidIndex(Entry) ? PickGlobalIndices[Entry] : INDEX_NONE;
+}
+
+void UBaseLayoutStrategy::UpdatePickIndex(const TConstArrayView<int32> GlobalIndices, const TConstArrayView<FVector2D> Positions)
+{
+	const int32 NumEntries = FMath::Min(GlobalIndices.Num(), Positions.Num());
+
+	// Most updates are for entries that didn't move
+	if (NumEntries == PickPositions.Num() && !PickBucketStarts.IsEmpty()
+		&& FMemory::Memcmp(PickGlobalIndices.GetData(), GlobalIndices.GetData(), NumEntries * sizeof(int32)) == 0
+		&& FMemory::Memcmp(PickPositions.GetData(), Positions.GetData(), NumEntries * sizeof(FVector2D)) == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	PickGlobalIndices.Reset(NumEntries);
+	PickGlobalIndices.Append(GlobalIndices.GetData(), NumEntries);
+	PickPositions.Reset(NumEntries);
+	PickPositions.Append(Positions.GetData(), NumEntries);
+
+	if (NumEntries == 0)
+	{
+		InvalidatePickIndex();
+		return;
+	}
+	RebuildPickIndex();
+}
+
+void UBaseLayoutStrategy::InvalidatePickIndex()
+{
+	PickGlobalIndices.Reset();
+	PickPositions.Reset();
+	PickBucketStarts.Reset();
+	PickBucketEntries.Reset();
+}
+
+void UBaseLayoutStrategy::RebuildPickIndex()
+{
+	FBox2D Bounds(ForceInit);
+	for (const FVector2D& Position : PickPositions)
+	{
+		Bounds += Position;
+	}
+	const FVector2D Extent = Bounds.GetSize();
+
+	// Cells about as large as the average spacing keep a handful of entries per cell
+	float CellSize = PickGridCellSize;
+	if (CellSize <= 0.f)
+	{
+		const double Area = FMath::Max(Extent.X, 1.0) * FMath::Max(Extent.Y, 1.0);
+		CellSize = static_cast<float>(FMath::Sqrt(Area / PickPositions.Num()));
+	}
+	CellSize = FMath::Max3(CellSize, 1.f, static_cast<float>(FMath::Max(Extent.X, Extent.Y) / BaseLayoutStrategy::MaxPickGridDim));
+
+	PickGridOrigin = Bounds.Min;
+	PickGridResolvedCellSize = CellSize;
+	PickGridDims.X = FMath::Min(FMath::FloorToInt32(Extent.X / CellSize) + 1, BaseLayoutStrategy::MaxPickGridDim);
+	PickGridDims.Y = FMath::Min(FMath::FloorToInt32(Extent.Y / CellSize) + 1, BaseLayoutStrategy::MaxPickGridDim);
+
+	BuildPickBuckets(PickGridDims.X * PickGridDims.Y, [this](const FVector2D& Position)
+	{
+		const FVector2D Cell = (Position - PickGridOrigin) / PickGridResolvedCellSize;
+		const int32 CellX = FMath::Clamp(FMath::FloorToInt32(Cell.X), 0, PickGridDims.X - 1);
+		const int32 CellY = FMath::Clamp(FMath::FloorToInt32(Cell.Y), 0, PickGridDims.Y - 1);
+		return CellY * PickGridDims.X + CellX;
+	});
+}
+
+int32 UBaseLayoutStrategy::PickFromIndex(const FVector2D& LocalPoint, const float PickRadius) const
+{
+	if (PickGridResolvedCellSize <= 0.f || PickGridDims.X <= 0 || PickGridDims.Y <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Every cell the pick circle overlaps
+	const FVector2D MinCell = (LocalPoint - FVector2D(PickRadius) - PickGridOrigin) / PickGridResolvedCellSize;
+	const FVector2D MaxCell = (LocalPoint + FVector2D(PickRadius) - PickGridOrigin) / PickGridResolvedCellSize;
+	const int32 MinX = FMath::Max(FMath::FloorToInt32(MinCell.X), 0);
+	const int32 MinY = FMath::Max(FMath::FloorToInt32(MinCell.Y), 0);
+	const int32 MaxX = FMath::Min(FMath::FloorToInt32(MaxCell.X), PickGridDims.X - 1);
+	const int32 MaxY = FMath::Min(FMath::FloorToInt32(MaxCell.Y), PickGridDims.Y - 1);
+
+	float BestDistanceSquared = FMath::Square(PickRadius);
+	int32 BestEntry = INDEX_NONE;
+	for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+	{
+		for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+		{
+			BestEntry = FindClosestInPickBucket(CellY * PickGridDims.X + CellX, LocalPoint, BestDistanceSquared, BestEntry);
+		}
+	}
+	return BestEntry;
+}
+
+void UBaseLayoutStrategy::BuildPickBuckets(const int32 NumBuckets, const TFunctionRef<int32(const FVector2D&)> GetBucket)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const int32 NumEntries = PickPositions.Num();
+
+	// Counting sort: count per bucket (shifted by one), prefix sum, scatter
+	PickBucketStarts.Reset(NumBuckets + 1);
+	PickBucketStarts.AddZeroed(NumBuckets + 1);
+	PickEntryBuckets.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	for (int32 Entry = 0; Entry < NumEntries; ++Entry)
+	{
+		const int32 Bucket = PickEntryBuckets[Entry] = GetBucket(PickPositions[Entry]);
+		++PickBucketStarts[Bucket + 1];
+	}
+	for (int32 Bucket = 1; Bucket <= NumBuckets; ++Bucket)
+	{
+		PickBucketStarts[Bucket] += PickBucketStarts[Bucket - 1];
+	}
+
+	// Scatter through the starts, which leaves each one at the next bucket's start, then shift them back
+	PickBucketEntries.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	for (int32 Entry = 0; Entry < NumEntries; ++Entry)
+	{
+		PickBucketEntries[PickBucketStarts[PickEntryBuckets[Entry]]++] = Entry;
+	}
+	for (int32 Bucket = NumBuckets; Bucket > 0; --Bucket)
+	{
+		PickBucketStarts[Bucket] = PickBucketStarts[Bucket - 1];
+	}
+	PickBucketStarts[0] = 0;
+}
+
+int32 UBaseLayoutStrategy::FindClosestInPickBucket(const int32 Bucket, const FVector2D& LocalPoint, float& InOutBestDistanceSquared, int32 BestEntry) const
+{
+	for (int32 i = PickBucketStarts[Bucket]; i < PickBucketStarts[Bucket + 1]; ++i)
+	{
+		const int32 Entry = PickBucketEntries[i];
+		const float DistanceSquared = static_cast<float>(FVector2D::DistSquared(PickPositions[Entry], LocalPoint));
+		if (DistanceSquared <= InOutBestDistanceSquared)
+		{
+			InOutBestDistanceSquared = DistanceSquared;
+			BestEntry = Entry;
+		}
+	}
+	return BestEntry;
+}
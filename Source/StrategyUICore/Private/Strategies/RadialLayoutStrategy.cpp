@@ -13,6 +13,7 @@ void URadialLayoutStrategy::InitializeStrategy(const TScriptInterface<ILayoutStr
 	{
 		return;
 	}
+	CacheHostUsesEntryProxies(Host.GetObject());
 	SetNumItems(ILayoutStrategyHost::Execute_GetNumItems(Host.GetObject()));
 
 	UpdateGapSegments(NumItems);
@@ -32,16 +33,10 @@ void URadialLayoutStrategy::ValidateStrategy(TArray<FText>& OutErrors) const
 	}
 }
 
-TSet<int32> URadialLayoutStrategy::ComputeDesiredGlobalIndices()
+FInt32Range URadialLayoutStrategy::ComputeDesiredGlobalIndexRange()
 {
-	DesiredGlobalIndices.Empty(RadialSegmentCount);
-
 	// All segment indices are desired in a basic radial wheel layout
-	for (int32 i = 0; i < RadialSegmentCount; ++i)
-	{
-		DesiredGlobalIndices.Add(i);
-	}
-	return DesiredGlobalIndices;
+	return FInt32Range(0, FMath::Max(RadialSegmentCount, 0));
 }
 
 int32 URadialLayoutStrategy::GlobalIndexToDataIndex(const int32 GlobalIndex) const
@@ -152,6 +147,27 @@ float URadialLayoutStrategy::SanitizeAngle(const float InAngle) const
 	return InAngle;
 }
 
+int32 URadialLayoutStrategy::FindGlobalIndexForAngle(const float InAngle) const
+{
+	if (FMath::IsNearlyZero(AngularSpacing))
+	{
+		return 0;
+	}
+	return FMath::FloorToInt((SanitizeAngle(InAngle) + AngularSpacing * 0.5f) / AngularSpacing);
+}
+
+FInt32Range URadialLayoutStrategy::ComputeDesiredGlobalIndexRangeForAngle(const float InAngle) const
+{
+	// Same as ComputeDesiredGlobalIndexRange, the basic wheel doesn't depend on the pointer
+	return FInt32Range(0, FMath::Max(RadialSegmentCount, 0));
+}
+
+void URadialLayoutStrategy::GetDeactivatedMargins(int32& OutLowerMargin, int32& OutUpperMargin) const
+{
+	OutLowerMargin = NumDeactivatedEntries;
+	OutUpperMargin = NumDeactivatedEntries;
+}
+
 void URadialLayoutStrategy::UpdateAngularSpacing()
 {
 	AngularSpacing = (RadialSegmentCount > 0) ? (360.f / RadialSegmentCount) : 0.f;
@@ -175,4 +191,127 @@ float URadialLayoutStrategy::CalculateItemAngleDegreesForGlobalIndex(const int32
 float URadialLayoutStrategy::CalculateRadiusForGlobalIndex(const int32 GlobalIndex) const
 {
 	return BaseRadius;
-}
\ No newline at end of file
+}
+
+void URadialLayoutStrategy::ComputeItemAnglesDegrees(const FInt32Range& GlobalIndexRange, TArrayView<float> OutAnglesDegrees) const
+{
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutAnglesDegrees.Num());
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutAnglesDegrees[i] = CalculateItemAngleDegreesForGlobalIndex(FirstGlobalIndex + i);
+	}
+}
+
+void URadialLayoutStrategy::ComputeDistanceFactors(const FInt32Range& GlobalIndexRange, TArrayView<float> OutDistanceFactors) const
+{
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutDistanceFactors.Num());
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutDistanceFactors[i] = CalculateDistanceFactorForGlobalIndex(FirstGlobalIndex + i);
+	}
+}
+
+void URadialLayoutStrategy::ComputePolarPositions(const TConstArrayView<float> AnglesDegrees, const TConstArrayView<float> Radii, TArrayView<FVector2D> OutPositions)
+{
+	const int32 Count = FMath::Min3(AnglesDegrees.Num(), Radii.Num(), OutPositions.Num());
+	const VectorRegister4Float DegreesToRadians = VectorSetFloat1(PI / 180.f);
+
+	int32 i = 0;
+	for (; i + 4 <= Count; i += 4)
+	{
+		const VectorRegister4Float Radians = VectorMultiply(VectorLoad(&AnglesDegrees[i]), DegreesToRadians);
+		VectorRegister4Float Sin, Cos;
+		VectorSinCos(&Sin, &Cos, &Radians);
+
+		const VectorRegister4Float Radius = VectorLoad(&Radii[i]);
+		alignas(16) float X[4];
+		alignas(16) float Y[4];
+		VectorStoreAligned(VectorMultiply(Radius, Cos), X);
+		VectorStoreAligned(VectorMultiply(Radius, Sin), Y);
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			OutPositions[i + Lane] = FVector2D(X[Lane], Y[Lane]);
+		}
+	}
+
+	// Remainder
+	for (; i < Count; ++i)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(AnglesDegrees[i]));
+		OutPositions[i] = FVector2D(Radii[i] * Cos, Radii[i] * Sin);
+	}
+}
+
+void URadialLayoutStrategy::FillLayoutSnapshot(FRadialLayoutSnapshot& OutSnapshot, const float InPointerAngle) const
+{
+	OutSnapshot.PointerAngle = SanitizeAngle(InPointerAngle);
+	OutSnapshot.AngularSpacing = AngularSpacing;
+	OutSnapshot.BaseRadius = BaseRadius;
+	OutSnapshot.MinRadius = GetMinRadius();
+	OutSnapshot.MaxRadius = GetMaxRadius();
+	OutSnapshot.NumItems = NumItems;
+	OutSnapshot.GapPaddingSegments = GapPaddingSegments;
+}
+
+void URadialLayoutStrategy::RebuildPickIndex()
+{
+	// About one entry per bucket on a wheel; spirals stack their turns into the same buckets
+	NumPickAngleBuckets = FMath::Clamp(PickPositions.Num(), 8, 360);
+
+	const float BucketsPerDegree = NumPickAngleBuckets / 360.f;
+	BuildPickBuckets(NumPickAngleBuckets, [this, BucketsPerDegree](const FVector2D& Position)
+	{
+		const float AngleDeg = FRotator::ClampAxis(FMath::RadiansToDegrees(FMath::Atan2(Position.Y, Position.X)));
+		return FMath::Clamp(FMath::FloorToInt32(AngleDeg * BucketsPerDegree), 0, NumPickAngleBuckets - 1);
+	});
+}
+
+int32 URadialLayoutStrategy::PickFromIndex(const FVector2D& LocalPoint, const float PickRadius) const
+{
+	if (NumPickAngleBuckets <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	float BestDistanceSquared = FMath::Square(PickRadius);
+	int32 BestEntry = INDEX_NONE;
+
+	// Within PickRadius of the center every angle is in reach
+	const double DistanceToCenter = LocalPoint.Size();
+	if (DistanceToCenter <= PickRadius)
+	{
+		for (int32 Bucket = 0; Bucket < NumPickAngleBuckets; ++Bucket)
+		{
+			BestEntry = FindClosestInPickBucket(Bucket, LocalPoint, BestDistanceSquared, BestEntry);
+		}
+		return BestEntry;
+	}
+
+	// The angles the pick circle spans, as seen from the center
+	const float BucketsPerDegree = NumPickAngleBuckets / 360.f;
+	const float AngleDeg = FRotator::ClampAxis(FMath::RadiansToDegrees(FMath::Atan2(LocalPoint.Y, LocalPoint.X)));
+	const float HalfSpanDeg = FMath::RadiansToDegrees(FMath::Asin(static_cast<float>(PickRadius / DistanceToCenter)));
+	const int32 FirstBucket = FMath::FloorToInt32((AngleDeg - HalfSpanDeg) * BucketsPerDegree);
+	const int32 LastBucket = FMath::Min(FMath::FloorToInt32((AngleDeg + HalfSpanDeg) * BucketsPerDegree), FirstBucket + NumPickAngleBuckets - 1);
+	for (int32 Bucket = FirstBucket; Bucket <= LastBucket; ++Bucket)
+	{
+		// Wrap around 0°
+		const int32 WrappedBucket = (Bucket % NumPickAngleBuckets + NumPickAngleBuckets) % NumPickAngleBuckets;
+		BestEntry = FindClosestInPickBucket(WrappedBucket, LocalPoint, BestDistanceSquared, BestEntry);
+	}
+	return BestEntry;
+}
@@ -0,0 +1,419 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Subsystems/StrategyEntryPoolSubsystem.h"
+
+#include <Blueprint/UserWidget.h>
+#include <Engine/GameInstance.h>
+#include <Engine/World.h>
+#include <HAL/IConsoleManager.h>
+#include <Misc/CoreDelegates.h>
+
+#include <AsyncWidgetLoaderSubsystem.h>
+
+#include "Settings/StrategyUIProjectSettings.h"
+#include "Utils/LogStrategyUI.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyEntryPoolSubsystem)
+
+namespace StrategyEntryPool
+{
+	/** How often the idle trim looks for stale free widgets, in seconds. */
+	constexpr float IdleTrimInterval = 1.f;
+
+	UStrategyEntryPoolSubsystem* Find(const UWorld* World)
+	{
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UStrategyEntryPoolSubsystem>() : nullptr;
+	}
+
+	static FAutoConsoleCommandWithWorld DumpStatsCommand(
+		TEXT("StrategyUI.EntryPool.Stats"),
+		TEXT("Logs the shared entry widget pool's statistics per class."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const UStrategyEntryPoolSubsystem* EntryPool = Find(World))
+			{
+				EntryPool->DumpPoolStats();
+			}
+		})
+	);
+
+	static FAutoConsoleCommandWithWorld TrimCommand(
+		TEXT("StrategyUI.EntryPool.Trim"),
+		TEXT("Drops every free entry widget in the shared pool, leaving it to garbage collection."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UStrategyEntryPoolSubsystem* EntryPool = Find(World))
+			{
+				EntryPool->TrimPool(0, 0);
+			}
+		})
+	);
+}
+
+void UStrategyEntryPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	AsyncWidgetLoader = Collection.InitializeDependency<UAsyncWidgetLoaderSubsystem>();
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UStrategyEntryPoolSubsystem::OnWorldCleanup);
+	MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddUObject(this, &UStrategyEntryPoolSubsystem::OnMemoryTrim);
+	IdleTrimTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UStrategyEntryPoolSubsystem::TickIdleTrim),
+		StrategyEntryPool::IdleTrimInterval
+	);
+}
+
+void UStrategyEntryPoolSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(IdleTrimTickerHandle);
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	EmptyPool();
+	AsyncWidgetLoader = nullptr;
+
+	Super::Deinitialize();
+}
+
+UUserWidget* UStrategyEntryPoolSubsystem::AcquireWidget(const TSubclassOf<UUserWidget> WidgetClass, const UWorld* World, const APlayerController* OwningPlayer, const bool bRecordStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!WidgetClass)
+	{
+		return nullptr; // Not loaded yet, the loader will have to stream it in
+	}
+
+	FStrategyEntryPoolBucket& Bucket = Buckets.FindOrAdd(WidgetClass);
+
+	// Most recently released first, it's the likeliest to still be warm
+	for (int32 Idx = Bucket.FreeWidgets.Num() - 1; Idx >= 0; --Idx)
+	{
+		UUserWidget* Widget = Bucket.FreeWidgets[Idx];
+		if (!IsValid(Widget))
+		{
+			Bucket.FreeWidgets.RemoveAt(Idx, 1, EAllowShrinking::No);
+			Bucket.ReleaseTimes.RemoveAt(Idx, 1, EAllowShrinking::No);
+			--NumPooledWidgets;
+			continue;
+		}
+
+		if (Widget->GetWorld() != World || Widget->GetOwningPlayer() != OwningPlayer)
+		{
+			continue; // Made for another world or local player
+		}
+
+		Bucket.FreeWidgets.RemoveAt(Idx, 1, EAllowShrinking::No);
+		Bucket.ReleaseTimes.RemoveAt(Idx, 1, EAllowShrinking::No);
+		--NumPooledWidgets;
+		if (bRecordStats)
+		{
+			++Bucket.NumHits;
+		}
+		return Widget;
+	}
+
+	if (bRecordStats)
+	{
+		++Bucket.NumMisses;
+	}
+	return nullptr;
+}
+
+void UStrategyEntryPoolSubsystem::ReleaseWidget(UUserWidget* Widget)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	const UStrategyUIProjectSettings* Settings = UStrategyUIProjectSettings::Get();
+	FStrategyEntryPoolBucket& Bucket = Buckets.FindOrAdd(Widget->GetClass());
+	if (!ensureMsgf(!Bucket.FreeWidgets.Contains(Widget), TEXT("%s was released to the entry pool twice"), *Widget->GetName()))
+	{
+		return;
+	}
+
+	if (Settings->MaxPooledEntryWidgets <= 0 || Settings->MaxPooledEntryWidgetsPerClass == 0)
+	{
+		++Bucket.NumTrimmed;
+		ReturnWidgetToLoader(Widget);
+		bHasTrimmedWidgets = true;
+		ReleaseTrimmedWidgets();
+		return;
+	}
+
+	Bucket.FreeWidgets.Add(Widget);
+	Bucket.ReleaseTimes.Add(FPlatformTime::Seconds());
+	++NumPooledWidgets;
+
+	// Keep within budget, the class's own oldest widgets go first if it's the one over
+	if (Settings->MaxPooledEntryWidgetsPerClass > 0)
+	{
+		while (Bucket.FreeWidgets.Num() > Settings->MaxPooledEntryWidgetsPerClass)
+		{
+			TrimLeastRecentlyReleased(&Bucket);
+		}
+	}
+	while (NumPooledWidgets > Settings->MaxPooledEntryWidgets)
+	{
+		TrimLeastRecentlyReleased();
+	}
+	ReleaseTrimmedWidgets();
+}
+
+void UStrategyEntryPoolSubsystem::NotifyWidgetFromLoader(const UUserWidget* Widget)
+{
+	if (IsValid(Widget))
+	{
+		Buckets.FindOrAdd(Widget->GetClass()).KnownWidgets.Add(FObjectKey(Widget));
+	}
+}
+
+void UStrategyEntryPoolSubsystem::EmptyPool()
+{
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Returning %d pooled entry widgets to the loader"), __FUNCTION__, NumPooledWidgets);
+
+	for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		for (UUserWidget* Widget : Pair.Value.FreeWidgets)
+		{
+			ReturnWidgetToLoader(Widget);
+		}
+	}
+	Buckets.Reset();
+	NumPooledWidgets = 0;
+}
+
+void UStrategyEntryPoolSubsystem::TrimPool(int32 MaxTotalWidgets, int32 MaxWidgetsPerClass)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const UStrategyUIProjectSettings* Settings = UStrategyUIProjectSettings::Get();
+	MaxTotalWidgets = MaxTotalWidgets < 0 ? Settings->MaxPooledEntryWidgets : MaxTotalWidgets;
+	MaxWidgetsPerClass = MaxWidgetsPerClass < 0 ? Settings->MaxPooledEntryWidgetsPerClass : MaxWidgetsPerClass;
+
+	const int32 NumPooledBefore = NumPooledWidgets;
+	if (MaxWidgetsPerClass >= 0)
+	{
+		for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+		{
+			while (Pair.Value.FreeWidgets.Num() > MaxWidgetsPerClass)
+			{
+				TrimLeastRecentlyReleased(&Pair.Value);
+			}
+		}
+	}
+	while (NumPooledWidgets > FMath::Max(0, MaxTotalWidgets))
+	{
+		TrimLeastRecentlyReleased();
+	}
+	ReleaseTrimmedWidgets();
+
+	UE_CLOG(
+		NumPooledBefore != NumPooledWidgets,
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Trimmed %d pooled entry widgets"),
+		__FUNCTION__,
+		NumPooledBefore - NumPooledWidgets
+	);
+}
+
+TArray<FStrategyEntryPoolStats> UStrategyEntryPoolSubsystem::GetPoolStatsPerClass() const
+{
+	TArray<FStrategyEntryPoolStats> Stats;
+	Stats.Reserve(Buckets.Num());
+	for (const TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		Stats.Add(MakeStats(Pair.Key, Pair.Value));
+	}
+	return Stats;
+}
+
+FStrategyEntryPoolStats UStrategyEntryPoolSubsystem::GetTotalPoolStats() const
+{
+	FStrategyEntryPoolStats Total;
+	for (const TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		Total.Accumulate(MakeStats(Pair.Key, Pair.Value));
+	}
+	return Total;
+}
+
+void UStrategyEntryPoolSubsystem::ResetPoolStats()
+{
+	for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		FStrategyEntryPoolBucket& Bucket = Pair.Value;
+		Bucket.KnownWidgets.Reset();
+		Bucket.NumHits = 0;
+		Bucket.NumMisses = 0;
+		Bucket.NumTrimmed = 0;
+	}
+}
+
+void UStrategyEntryPoolSubsystem::DumpPoolStats() const
+{
+	UE_LOG(LogStrategyUI, Log, TEXT("Strategy entry pool (%d free widgets):"), NumPooledWidgets);
+	for (const FStrategyEntryPoolStats& Stats : GetPoolStatsPerClass())
+	{
+		UE_LOG(
+			LogStrategyUI,
+			Log,
+			TEXT("  %s: Pooled=%d Hits=%d Misses=%d HitRatio=%.2f Instantiated=%d Trimmed=%d"),
+			*GetNameSafe(Stats.WidgetClass),
+			Stats.NumPooled,
+			Stats.NumHits,
+			Stats.NumMisses,
+			Stats.GetHitRatio(),
+			Stats.NumInstantiated,
+			Stats.NumTrimmed
+		);
+	}
+
+	const FStrategyEntryPoolStats Total = GetTotalPoolStats();
+	UE_LOG(
+		LogStrategyUI,
+		Log,
+		TEXT("  Total: Pooled=%d Hits=%d Misses=%d HitRatio=%.2f Instantiated=%d Trimmed=%d"),
+		Total.NumPooled,
+		Total.NumHits,
+		Total.NumMisses,
+		Total.GetHitRatio(),
+		Total.NumInstantiated,
+		Total.NumTrimmed
+	);
+}
+
+void UStrategyEntryPoolSubsystem::TrimLeastRecentlyReleased(FStrategyEntryPoolBucket* Bucket)
+{
+	// Each bucket is ordered by release, so the oldest widget is at the front of one of them
+	if (!Bucket)
+	{
+		for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+		{
+			FStrategyEntryPoolBucket& Candidate = Pair.Value;
+			if (!Candidate.ReleaseTimes.IsEmpty() && (!Bucket || Candidate.ReleaseTimes[0] < Bucket->ReleaseTimes[0]))
+			{
+				Bucket = &Candidate;
+			}
+		}
+	}
+
+	if (!Bucket)
+	{
+		NumPooledWidgets = 0; // Nothing's left to trim, the count drifted
+		return;
+	}
+
+	if (!Bucket->FreeWidgets.IsEmpty())
+	{
+		TrimWidgetAt(*Bucket, 0);
+	}
+}
+
+void UStrategyEntryPoolSubsystem::TrimWidgetAt(FStrategyEntryPoolBucket& Bucket, const int32 FreeIndex)
+{
+	ReturnWidgetToLoader(Bucket.FreeWidgets[FreeIndex]);
+	Bucket.FreeWidgets.RemoveAt(FreeIndex, 1, EAllowShrinking::No);
+	Bucket.ReleaseTimes.RemoveAt(FreeIndex, 1, EAllowShrinking::No);
+	++Bucket.NumTrimmed;
+	--NumPooledWidgets;
+	bHasTrimmedWidgets = true;
+}
+
+bool UStrategyEntryPoolSubsystem::TickIdleTrim(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const float IdleTrimSeconds = UStrategyUIProjectSettings::Get()->PooledEntryWidgetIdleTrimSeconds;
+	if (IdleTrimSeconds <= 0.f || NumPooledWidgets == 0)
+	{
+		return true;
+	}
+
+	// Release times only grow along each bucket, so stale widgets are always at the front
+	const double StaleBefore = FPlatformTime::Seconds() - IdleTrimSeconds;
+	for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		FStrategyEntryPoolBucket& Bucket = Pair.Value;
+		while (!Bucket.ReleaseTimes.IsEmpty() && Bucket.ReleaseTimes[0] < StaleBefore)
+		{
+			TrimWidgetAt(Bucket, 0);
+		}
+	}
+	ReleaseTrimmedWidgets();
+	return true;
+}
+
+void UStrategyEntryPoolSubsystem::OnMemoryTrim()
+{
+	if (UStrategyUIProjectSettings::Get()->bTrimEntryPoolOnMemoryWarning)
+	{
+		UE_LOG(LogStrategyUI, Log, TEXT("%hs: Memory trim requested, trimming %d pooled entry widgets"), __FUNCTION__, NumPooledWidgets);
+		TrimPool(0, 0);
+	}
+}
+
+void UStrategyEntryPoolSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	for (TPair<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket>& Pair : Buckets)
+	{
+		FStrategyEntryPoolBucket& Bucket = Pair.Value;
+		for (int32 Idx = Bucket.FreeWidgets.Num() - 1; Idx >= 0; --Idx)
+		{
+			const UUserWidget* Widget = Bucket.FreeWidgets[Idx];
+			if (!IsValid(Widget) || Widget->GetWorld() == World)
+			{
+				TrimWidgetAt(Bucket, Idx);
+			}
+		}
+	}
+	ReleaseTrimmedWidgets();
+}
+
+void UStrategyEntryPoolSubsystem::ReturnWidgetToLoader(UUserWidget* Widget) const
+{
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	// The Slate tree is the bulk of an idle widget's memory, it's rebuilt on the next TakeWidget
+	Widget->ReleaseSlateResources(true);
+	if (AsyncWidgetLoader)
+	{
+		AsyncWidgetLoader->ReleaseWidgetToPool(Widget);
+	}
+}
+
+void UStrategyEntryPoolSubsystem::ReleaseTrimmedWidgets()
+{
+	if (!bHasTrimmedWidgets)
+	{
+		return;
+	}
+	bHasTrimmedWidgets = false;
+
+	// The loader's pools are the last thing referencing trimmed widgets. Widgets in use stay referenced by their owners,
+	// and once forgotten by the loader, handing them back to it later just lets them go too.
+	if (AsyncWidgetLoader)
+	{
+		AsyncWidgetLoader->ResetWidgetPools();
+	}
+}
+
+FStrategyEntryPoolStats UStrategyEntryPoolSubsystem::MakeStats(const TSubclassOf<UUserWidget> WidgetClass, const FStrategyEntryPoolBucket& Bucket) const
+{
+	FStrategyEntryPoolStats Stats;
+	Stats.WidgetClass = WidgetClass;
+	Stats.NumPooled = Bucket.FreeWidgets.Num();
+	Stats.NumHits = Bucket.NumHits;
+	Stats.NumMisses = Bucket.NumMisses;
+	Stats.NumInstantiated = Bucket.KnownWidgets.Num();
+	Stats.NumTrimmed = Bucket.NumTrimmed;
+	return Stats;
+}
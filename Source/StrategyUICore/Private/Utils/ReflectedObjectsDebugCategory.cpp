@@ -46,44 +46,64 @@ void FReflectedObjectsDebugCategory::ClearTargets()
 
 void FReflectedObjectsDebugCategory::SetCategoryFilters(const TArray<FString>& InFilters)
 {
+	if (PropertyCategoryFilters == InFilters)
+	{
+		return;
+	}
+
+	// Layouts only hold the categories that pass the filters
 	PropertyCategoryFilters = InFilters;
+	ClassLayouts.Reset();
 }
 
 void FReflectedObjectsDebugCategory::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
 	// 1) Clear old lines
 	ResetReplicatedData();
 
-	CachedLines.Empty(128);
-	//CurrentPage = 0;
+	CachedLines.Reset();
+	PruneRowCaches();
 
 	// 2) If no target objects, note that
 	if (TargetObjects.Num() == 0)
 	{
 		CachedLines.Add(TEXT("No target objects assigned to FStrategyUILocalDebugCategory."));
+		TotalLines = CachedLines.Num();
 		return;
 	}
 
+	// Only the page DrawData will show gets formatted (until it has drawn once, assume a 1080p canvas)
+	const int32 PageLines = LinesPerPage > 0 ? LinesPerPage : FMath::FloorToInt(1080.f / CharHeight);
+	PageStartLine = FMath::Min(CurrentPage * PageLines, FMath::Max(TotalLines - 1, 0) / FMath::Max(PageLines, 1) * PageLines);
+	PageEndLine = PageStartLine + PageLines;
+	CollectLineIndex = 0;
+
 	// 3) For each target, reflect
 	for (TWeakObjectPtr<UObject>& WeakObj : TargetObjects)
 	{
 		UObject* Obj = WeakObj.Get();
 		if (!Obj)
 		{
-			CachedLines.Add(TEXT("TargetObject is invalid (GCed?)."));
+			EmitLine([] { return FString(TEXT("TargetObject is invalid (GCed?).")); });
 			continue;
 		}
 
 		// Title
-		CachedLines.Add(FString::Printf(TEXT("=== Reflecting: %s (%s) ==="),
-			*Obj->GetName(), *Obj->GetClass()->GetName()));
+		EmitLine([Obj]
+		{
+			return FString::Printf(TEXT("=== Reflecting: %s (%s) ==="), *Obj->GetName(), *Obj->GetClass()->GetName());
+		});
 
 		// Reflect
 		ReflectObjectProperties(Obj);
 
 		// Blank line
-		CachedLines.Add(TEXT(""));
+		EmitLine([] { return FString(); });
 	}
+
+	TotalLines = CollectLineIndex;
 }
 
 void FReflectedObjectsDebugCategory::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
@@ -91,18 +111,15 @@ void FReflectedObjectsDebugCategory::DrawData(APlayerController* OwnerPC, FGamep
 	// Determine how many lines fit on the screen based on canvas size and font height.
 	const UCanvas* Canvas = CanvasContext.Canvas.Get();
 	const float ScreenHeight = Canvas ? Canvas->SizeY : 1080.f;
-	const int32 TotalLines = CachedLines.Num();
 	
 	LinesPerPage = FMath::FloorToInt(ScreenHeight / CharHeight);
 	TotalPages = (LinesPerPage > 0) ? FMath::CeilToInt(static_cast<float>(TotalLines) / LinesPerPage) : 1;
 	TotalPages = FMath::Max(TotalPages, 1);
 	CurrentPage = FMath::Clamp(CurrentPage, 0, TotalPages - 1);
 
-	const int32 StartIndex = CurrentPage * LinesPerPage;
-	const int32 EndIndex = FMath::Min(StartIndex + LinesPerPage, TotalLines);
-
-	// Draw only the lines for the current page.
-	for (int32 i = StartIndex; i < EndIndex; i++)
+	// CachedLines only holds the current page (as of the last collect)
+	const int32 EndIndex = FMath::Min(LinesPerPage, CachedLines.Num());
+	for (int32 i = 0; i < EndIndex; i++)
 	{
 		CanvasContext.Printf(TEXT("%s"), *CachedLines[i]);
 	}
@@ -127,21 +144,35 @@ void FReflectedObjectsDebugCategory::PrevPage()
 	}
 }
 
-void FReflectedObjectsDebugCategory::ReflectObjectProperties(UObject* Obj)
+bool FReflectedObjectsDebugCategory::FPropertyRowCache::SnapshotValue(const void* ValuePtr)
 {
-	if (!Obj)
+	// Compared as exported text, a live copy would keep whatever the value points to (e.g. Slate widgets) alive
+	FString ExportedValue;
+	for (int32 i = 0; i < Property->ArrayDim; ++i)
 	{
-		CachedLines.Add(TEXT("Cannot reflect a null object."));
-		return;
+		const uint8* ElementPtr = static_cast<const uint8*>(ValuePtr) + i * Property->GetElementSize();
+		Property->ExportText_Direct(ExportedValue, ElementPtr, ElementPtr, nullptr, PPF_None);
 	}
 
-	const UClass* Class = Obj->GetClass();
-	if (!Class)
+	if (bHasSnapshot && ExportedValue.Equals(ValueSnapshot, ESearchCase::CaseSensitive))
 	{
-		CachedLines.Add(TEXT("Object has no valid UClass?"));
-		return;
+		return true;
+	}
+
+	ValueSnapshot = MoveTemp(ExportedValue);
+	bHasSnapshot = true;
+	return false;
+}
+
+const FReflectedObjectsDebugCategory::FClassLayout& FReflectedObjectsDebugCategory::GetClassLayout(const UClass* Class)
+{
+	if (const FClassLayout* Existing = ClassLayouts.Find(Class); Existing && Existing->Class.IsValid())
+	{
+		return *Existing;
 	}
 
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
 	// Group properties by Category
 	TMap<FString, TArray<FProperty*>> CategoryMap;
 	for (TFieldIterator<FProperty> It(Class); It; ++It)
@@ -163,6 +194,9 @@ void FReflectedObjectsDebugCategory::ReflectObjectProperties(UObject* Obj)
 	CategoryMap.GetKeys(SortedCategories);
 	SortedCategories.Sort();
 
+	FClassLayout& Layout = ClassLayouts.Add(Class);
+	Layout.Class = Class;
+
 	// For each Category
 	for (const FString& Cat : SortedCategories)
 	{
@@ -185,183 +219,278 @@ void FReflectedObjectsDebugCategory::ReflectObjectProperties(UObject* Obj)
 			continue;
 		}
 
-		// Print category header
-		CachedLines.Add(FString::Printf(TEXT("[Category: %s]"), *Cat));
-
 		// Sort the properties by display name
-		TArray<FString> PropNames;
-		TMap<FString, FProperty*> NameToProp;
+		TArray<TPair<FString, FProperty*>> NamedProps;
 		for (FProperty* P : CategoryMap[Cat])
 		{
-			if (!P) continue;
 			FString DisplayName = P->GetDisplayNameText().ToString();
 			if (DisplayName.IsEmpty())
 			{
 				DisplayName = P->GetName();
 			}
-			PropNames.Add(DisplayName);
-			NameToProp.Add(DisplayName, P);
+			NamedProps.Emplace(MoveTemp(DisplayName), P);
 		}
-		PropNames.Sort();
+		NamedProps.StableSort([](const TPair<FString, FProperty*>& A, const TPair<FString, FProperty*>& B) { return A.Key < B.Key; });
 
-		// Print each property
-		for (const FString& DisplayName : PropNames)
+		FCategoryLayout& Category = Layout.Categories.AddDefaulted_GetRef();
+		Category.Header = FString::Printf(TEXT("[Category: %s]"), *Cat);
+		for (TPair<FString, FProperty*>& NamedProp : NamedProps)
 		{
-			FProperty* Property = NameToProp[DisplayName];
-			if (!Property)
-			{
-				continue;
-			}
+			Category.DisplayNames.Add(MoveTemp(NamedProp.Key));
+			Category.Properties.Add(NamedProp.Value);
+		}
+	}
 
-			// If property is a TMap, reflect it specially.
-			if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
-			{
-				ReflectTMapProperty(MapProp, Obj, DisplayName);
-			}
-			else
-			{
-				// Normal property reflection
-				const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Obj);
-				if (!ValuePtr)
-				{
-					continue;
-				}
+	return Layout;
+}
 
-				// Export property value to string
-				FString ValueStr;
-				Property->ExportText_Direct(ValueStr, ValuePtr, ValuePtr, Obj, PPF_None);
+void FReflectedObjectsDebugCategory::PruneRowCaches()
+{
+	for (auto It = RowCaches.CreateIterator(); It; ++It)
+	{
+		const UObject* Obj = It.Key().Key.ResolveObjectPtr();
+		if (!Obj || !TargetObjects.Contains(Obj))
+		{
+			It.RemoveCurrent();
+		}
+	}
 
-				// If it’s a GameplayTagContainer, convert it to string specially.
-				if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-				{
-					if (StructProp->Struct == TBaseStructure<FGameplayTagContainer>::Get())
-					{
-						if (const FGameplayTagContainer* TagContainer = static_cast<const FGameplayTagContainer*>(ValuePtr))
-						{
-							ValueStr = TagContainer->ToString();
-						}
-					}
-				}
+	for (auto It = ClassLayouts.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Class.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
 
-				// Get a color for this property type
-				const FString& PropColor = GetPropertyColor(Property);
+void FReflectedObjectsDebugCategory::ReflectObjectProperties(UObject* Obj)
+{
+	if (!Obj)
+	{
+		EmitLine([] { return FString(TEXT("Cannot reflect a null object.")); });
+		return;
+	}
 
-				CachedLines.Add(
-					 FString::Printf(TEXT("%s%s = %s"), 
-						 *PropColor, // start color
-						 *DisplayName, 
-						 *ValueStr
-					 )
-				 );
-			}
+	const UClass* Class = Obj->GetClass();
+	if (!Class)
+	{
+		EmitLine([] { return FString(TEXT("Object has no valid UClass?")); });
+		return;
+	}
+
+	for (const FCategoryLayout& Category : GetClassLayout(Class).Categories)
+	{
+		// Print category header
+		EmitLine([&Category] { return Category.Header; });
+
+		// Print each property
+		for (int32 i = 0; i < Category.Properties.Num(); ++i)
+		{
+			ReflectProperty(Obj, Category.Properties[i], Category.DisplayNames[i]);
 		}
 
 		// Blank line after the category.
-		CachedLines.Add(TEXT(""));
+		EmitLine([] { return FString(); });
 	}
 }
 
-void FReflectedObjectsDebugCategory::ReflectTMapProperty(const FMapProperty* MapProp, UObject* Obj, const FString& DisplayName)
+void FReflectedObjectsDebugCategory::ReflectProperty(UObject* Obj, FProperty* Property, const FString& DisplayName)
 {
-	if (!MapProp || !Obj)
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Obj);
+	if (!ValuePtr)
 	{
 		return;
 	}
-	const void* MapPtr = MapProp->ContainerPtrToValuePtr<void>(Obj);
-	if (!MapPtr)
+
+	// Count the lines first, properties entirely off the page aren't looked at any further
+	const FMapProperty* MapProp = CastField<FMapProperty>(Property);
+	const int32 NumLines = MapProp ? 1 + FScriptMapHelper(MapProp, ValuePtr).Num() : 1;
+	if (CollectLineIndex + NumLines <= PageStartLine || CollectLineIndex >= PageEndLine)
 	{
+		CollectLineIndex += NumLines;
 		return;
 	}
 
-	FScriptMapHelper MapHelper(MapProp, MapPtr);
-	const int32 Num = MapHelper.Num();
+	TUniquePtr<FPropertyRowCache>& RowCache = RowCaches.FindOrAdd(MakeTuple(FObjectKey(Obj), static_cast<const FProperty*>(Property)));
+	if (!RowCache)
+	{
+		RowCache = MakeUnique<FPropertyRowCache>(Property);
+	}
 
-	// Print a summary line for the TMap.
-	CachedLines.Add(FString::Printf(TEXT("   %s (TMap) has %d entries:"), *DisplayName, Num));
+	// Re-format only what changed since it was last shown. Members that aren't UPROPERTYs don't show up in a snapshot.
+	if (HasUnreflectedState(Property) || !RowCache->SnapshotValue(ValuePtr) || RowCache->Lines.Num() != NumLines)
+	{
+		RowCache->Lines.SetNum(NumLines);
+		RowCache->FormattedLines.Init(false, NumLines);
+	}
 
-	FProperty* KeyProp = MapProp->KeyProp;
-	FProperty* ValueProp = MapProp->ValueProp;
+	const int32 FirstLineIndex = CollectLineIndex;
+	auto EmitRowLine = [this, &RowCache, FirstLineIndex](const int32 RowLine, auto&& MakeLine)
+	{
+		EmitLine([&]() -> FString
+		{
+			if (!RowCache->FormattedLines[RowLine])
+			{
+				RowCache->Lines[RowLine] = MakeLine();
+				RowCache->FormattedLines[RowLine] = true;
+			}
+			return RowCache->Lines[RowLine];
+		});
+	};
+
+	if (!MapProp)
+	{
+		EmitRowLine(0, [&] { return FormatPropertyLine(Property, DisplayName, ValuePtr, Obj); });
+		return;
+	}
+
+	// If property is a TMap, reflect it specially: a summary, then its entries in iteration order.
+	FScriptMapHelper MapHelper(MapProp, ValuePtr);
+	EmitRowLine(0, [&] { return FString::Printf(TEXT("   %s (TMap) has %d entries:"), *DisplayName, MapHelper.Num()); });
 
-	for (int32 i = 0; i < MapHelper.GetMaxIndex(); i++)
+	int32 RowLine = 1;
+	for (int32 SparseIndex = 0; SparseIndex < MapHelper.GetMaxIndex() && CollectLineIndex < PageEndLine; ++SparseIndex)
 	{
-		if (!MapHelper.IsValidIndex(i))
+		if (!MapHelper.IsValidIndex(SparseIndex))
 		{
 			continue;
 		}
+		EmitRowLine(RowLine++, [&] { return FormatMapEntryLine(MapProp, MapHelper, SparseIndex); });
+	}
+	CollectLineIndex = FirstLineIndex + NumLines;
+}
 
-		const void* KeyPtr   = MapHelper.GetKeyPtr(i);
-		const void* ValuePtr = MapHelper.GetValuePtr(i);
+bool FReflectedObjectsDebugCategory::HasUnreflectedState(const FProperty* Property)
+{
+	const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		StructProp = CastField<FStructProperty>(MapProp->ValueProp);
+	}
+	if (!StructProp)
+	{
+		return false;
+	}
+
+	// Shown through their own ToString, which covers members that aren't UPROPERTYs
+	return StructProp->Struct == TBaseStructure<FStrategyEntrySlotWindow>::Get()
+		|| StructProp->Struct == TBaseStructure<FStrategyEntrySlotData>::Get()
+		|| StructProp->Struct == TBaseStructure<FUserWidgetPool>::Get();
+}
 
-		// Convert the key to string.
-		FString KeyStr;
-		if (KeyProp)
+FString FReflectedObjectsDebugCategory::FormatPropertyLine(const FProperty* Property, const FString& DisplayName, const void* ValuePtr, const UObject* Obj)
+{
+	// Export property value to string
+	FString ValueStr;
+	Property->ExportText_Direct(ValueStr, ValuePtr, ValuePtr, const_cast<UObject*>(Obj), PPF_None);
+
+	// If it’s a GameplayTagContainer, convert it to string specially.
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		if (StructProp->Struct == TBaseStructure<FGameplayTagContainer>::Get())
 		{
-			if (const FClassProperty* ClassKeyProp = CastField<FClassProperty>(KeyProp))
+			if (const FGameplayTagContainer* TagContainer = static_cast<const FGameplayTagContainer*>(ValuePtr))
 			{
-				FClassProperty::TCppType ClassVal = ClassKeyProp->GetPropertyValue(KeyPtr);
-				KeyStr = ClassVal ? ClassVal->GetName() : TEXT("None");
+				ValueStr = TagContainer->ToString();
 			}
-			else
+		}
+		else if (StructProp->Struct == TBaseStructure<FStrategyEntrySlotWindow>::Get())
+		{
+			if (const FStrategyEntrySlotWindow* SlotWindow = static_cast<const FStrategyEntrySlotWindow*>(ValuePtr))
 			{
-				KeyProp->ExportText_Direct(KeyStr, KeyPtr, KeyPtr, nullptr, PPF_None);
+				ValueStr = SlotWindow->ToString();
 			}
 		}
+	}
+
+	// Get a color for this property type
+	const FString& PropColor = GetPropertyColor(Property);
 
-		// Convert the value to string.
-		FString ValStr;
-		if (ValueProp)
+	return FString::Printf(TEXT("%s%s = %s"), 
+		*PropColor, // start color
+		*DisplayName, 
+		*ValueStr
+	);
+}
+
+FString FReflectedObjectsDebugCategory::FormatMapEntryLine(const FMapProperty* MapProp, FScriptMapHelper& MapHelper, const int32 SparseIndex)
+{
+	FProperty* KeyProp = MapProp->KeyProp;
+	FProperty* ValueProp = MapProp->ValueProp;
+
+	const void* KeyPtr   = MapHelper.GetKeyPtr(SparseIndex);
+	const void* ValuePtr = MapHelper.GetValuePtr(SparseIndex);
+
+	// Convert the key to string.
+	FString KeyStr;
+	if (KeyProp)
+	{
+		if (const FClassProperty* ClassKeyProp = CastField<FClassProperty>(KeyProp))
 		{
-			if (FStructProperty* StructValProp = CastField<FStructProperty>(ValueProp))
+			FClassProperty::TCppType ClassVal = ClassKeyProp->GetPropertyValue(KeyPtr);
+			KeyStr = ClassVal ? ClassVal->GetName() : TEXT("None");
+		}
+		else
+		{
+			KeyProp->ExportText_Direct(KeyStr, KeyPtr, KeyPtr, nullptr, PPF_None);
+		}
+	}
+
+	// Convert the value to string.
+	FString ValStr;
+	if (ValueProp)
+	{
+		if (FStructProperty* StructValProp = CastField<FStructProperty>(ValueProp))
+		{
+			if (StructValProp->Struct == TBaseStructure<FGameplayTagContainer>::Get())
 			{
-				if (StructValProp->Struct == TBaseStructure<FGameplayTagContainer>::Get())
-				{
-					const FGameplayTagContainer* Tags = static_cast<const FGameplayTagContainer*>(ValuePtr);
-					ValStr = Tags ? Tags->ToString() : TEXT("None");
-				}
-				if (StructValProp->Struct == TBaseStructure<FStrategyEntrySlotData>::Get())
+				const FGameplayTagContainer* Tags = static_cast<const FGameplayTagContainer*>(ValuePtr);
+				ValStr = Tags ? Tags->ToString() : TEXT("None");
+			}
+			else if (StructValProp->Struct == TBaseStructure<FStrategyEntrySlotData>::Get())
+			{
+				if (const FStrategyEntrySlotData* SlotData = static_cast<const FStrategyEntrySlotData*>(ValuePtr))
 				{
-					if (const FStrategyEntrySlotData* SlotData = static_cast<const FStrategyEntrySlotData*>(ValuePtr))
-					{
-						ValStr = SlotData->ToString();
-					}
+					ValStr = SlotData->ToString();
 				}
-				if (StructValProp->Struct == TBaseStructure<FUserWidgetPool>::Get())
+			}
+			else if (StructValProp->Struct == TBaseStructure<FUserWidgetPool>::Get())
+			{
+				if (const FUserWidgetPool* Pool = static_cast<const FUserWidgetPool*>(ValuePtr))
 				{
-					if (const FUserWidgetPool* Pool = static_cast<const FUserWidgetPool*>(ValuePtr))
+					ValStr += TEXT("Active: \n");
+					for (const TArray<UUserWidget*>& Widgets = Pool->GetActiveWidgets(); const UUserWidget* Widget : Widgets)
 					{
-						ValStr += TEXT("Active: \n");
-						for (const TArray<UUserWidget*>& Widgets = Pool->GetActiveWidgets(); const UUserWidget* Widget : Widgets)
-						{
-							ValStr += TEXT("\t\t");
-							ValStr += Widget ? Widget->GetName() : TEXT("null");
-							ValStr += TEXT(", \n");
-						}
+						ValStr += TEXT("\t\t");
+						ValStr += Widget ? Widget->GetName() : TEXT("null");
+						ValStr += TEXT(", \n");
 					}
 				}
-				else
-				{
-					ValueProp->ExportText_Direct(ValStr, ValuePtr, ValuePtr, nullptr, PPF_None);
-				}
-			}
-			else if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(ValueProp))
-			{
-				const UObject* RefObj = ObjProp->GetObjectPropertyValue(ValuePtr);
-				ValStr = RefObj ? RefObj->GetName() : TEXT("null");
 			}
 			else
 			{
 				ValueProp->ExportText_Direct(ValStr, ValuePtr, ValuePtr, nullptr, PPF_None);
 			}
 		}
+		else if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(ValueProp))
+		{
+			const UObject* RefObj = ObjProp->GetObjectPropertyValue(ValuePtr);
+			ValStr = RefObj ? RefObj->GetName() : TEXT("null");
+		}
+		else
+		{
+			ValueProp->ExportText_Direct(ValStr, ValuePtr, ValuePtr, nullptr, PPF_None);
+		}
+	}
 
-		const FString& KeyColor = GetPropertyColor(KeyProp);
-		const FString& ValColor = GetPropertyColor(ValueProp);
+	const FString& KeyColor = GetPropertyColor(KeyProp);
+	const FString& ValColor = GetPropertyColor(ValueProp);
 
-		CachedLines.Add(FString::Printf(TEXT("      %s[%s] => %s%s"),
-			*KeyColor, *KeyStr,
-			*ValColor, *ValStr
-		));
-	}
+	return FString::Printf(TEXT("      %s[%s] => %s%s"),
+		*KeyColor, *KeyStr,
+		*ValColor, *ValStr
+	);
 }
 
 #endif // WITH_GAMEPLAY_DEBUGGER
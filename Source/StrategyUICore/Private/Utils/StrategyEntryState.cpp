@@ -0,0 +1,57 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Utils/StrategyEntryState.h"
+
+#include "Utils/StrategyUIGameplayTags.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyEntryState)
+
+namespace StrategyEntryState
+{
+	using namespace StrategyUIGameplayTags::StrategyUI;
+
+	EStrategyEntryState FromTag(const FGameplayTag& Tag)
+	{
+		if (Tag == EntryLifecycle::Loading)        { return EStrategyEntryState::Loading; }
+		if (Tag == EntryLifecycle::Pooled)         { return EStrategyEntryState::Pooled; }
+		if (Tag == EntryLifecycle::Deactivated)    { return EStrategyEntryState::Deactivated; }
+		if (Tag == EntryLifecycle::Active)         { return EStrategyEntryState::Active; }
+		if (Tag == EntryInteraction::Focused)      { return EStrategyEntryState::Focused; }
+		if (Tag == EntryInteraction::Selected)     { return EStrategyEntryState::Selected; }
+		return EStrategyEntryState::None;
+	}
+
+	const FGameplayTagContainer& ToTagContainer(const EStrategyEntryState State)
+	{
+		// 6 flags -> 64 possible masks, built on first use (native tags are registered by then)
+		static const TArray<FGameplayTagContainer> CachedContainers = []()
+		{
+			const TPair<EStrategyEntryState, FGameplayTag> FlagTags[] = {
+				{ EStrategyEntryState::Loading,     EntryLifecycle::Loading },
+				{ EStrategyEntryState::Pooled,      EntryLifecycle::Pooled },
+				{ EStrategyEntryState::Deactivated, EntryLifecycle::Deactivated },
+				{ EStrategyEntryState::Active,      EntryLifecycle::Active },
+				{ EStrategyEntryState::Focused,     EntryInteraction::Focused },
+				{ EStrategyEntryState::Selected,    EntryInteraction::Selected },
+			};
+
+			TArray<FGameplayTagContainer> Containers;
+			Containers.SetNum(1 << UE_ARRAY_COUNT(FlagTags));
+			for (int32 Mask = 0; Mask < Containers.Num(); ++Mask)
+			{
+				for (const TPair<EStrategyEntryState, FGameplayTag>& FlagTag : FlagTags)
+				{
+					if (EnumHasAnyFlags(static_cast<EStrategyEntryState>(Mask), FlagTag.Key))
+					{
+						Containers[Mask].AddTag(FlagTag.Value);
+					}
+				}
+			}
+			return Containers;
+		}();
+
+		const int32 Mask = static_cast<int32>(State);
+		check(CachedContainers.IsValidIndex(Mask));
+		return CachedContainers[Mask];
+	}
+}
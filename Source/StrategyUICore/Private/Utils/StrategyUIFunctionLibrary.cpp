@@ -38,12 +38,9 @@ TSubclassOf<UUserWidget> UStrategyUIFunctionLibrary::GetWidgetClassForTag(
 	}
 
 	// Look for a class in TagToWidgetClassMap
-	if (Settings->TagToWidgetClassMap.Contains(InTag))
+	if (const FStrategyUITagWidgetClasses* Found = Settings->FindWidgetClassesForTag(InTag); Found && Found->WidgetClass)
 	{
-		if (const TSubclassOf<UUserWidget> FoundClass = *Settings->TagToWidgetClassMap.Find(InTag))
-		{
-			return FoundClass;
-		}
+		return Found->WidgetClass;
 	}
 
 	if (bLogWarnings && Settings->bWarnOnMissingClass)
@@ -100,13 +97,10 @@ TSoftClassPtr<UUserWidget> UStrategyUIFunctionLibrary::GetWidgetSoftClassForTag(
 		return nullptr;
 	}
 
-	// Look for a class in TagToWidgetClassMap
-	if (Settings->TagToWidgetSoftClassMap.Contains(InTag))
+	// Look for a class in TagToWidgetSoftClassMap
+	if (const FStrategyUITagWidgetClasses* Found = Settings->FindWidgetClassesForTag(InTag); Found && !Found->WidgetSoftClass.IsNull())
 	{
-		if (const TSoftClassPtr<UUserWidget> FoundSoftClass = *Settings->TagToWidgetSoftClassMap.Find(InTag))
-		{
-			return FoundSoftClass;
-		}
+		return Found->WidgetSoftClass;
 	}
 
 	if (bLogWarnings && Settings->bWarnOnMissingClass)
@@ -0,0 +1,24 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Utils/StrategyUIStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyUIStats)
+
+DEFINE_STAT(STAT_StrategyUI_UpdateWidgets);
+DEFINE_STAT(STAT_StrategyUI_RebuildSlateForIndices);
+DEFINE_STAT(STAT_StrategyUI_UpdateChildrenData);
+DEFINE_STAT(STAT_StrategyUI_CanvasArrangeChildren);
+DEFINE_STAT(STAT_StrategyUI_CanvasPaint);
+DEFINE_STAT(STAT_StrategyUI_AcquireEntryWidget);
+DEFINE_STAT(STAT_StrategyUI_ReleaseEntryWidget);
+
+DEFINE_STAT(STAT_StrategyUI_EntryAcquires);
+DEFINE_STAT(STAT_StrategyUI_EntryReleases);
+DEFINE_STAT(STAT_StrategyUI_EntryPoolHits);
+DEFINE_STAT(STAT_StrategyUI_BlueprintDispatches);
+DEFINE_STAT(STAT_StrategyUI_AsyncLoadsCompleted);
+DEFINE_STAT(STAT_StrategyUI_AsyncLoadLatency);
+
+DEFINE_STAT(STAT_StrategyUI_LiveSlots);
+
+UE_TRACE_CHANNEL_DEFINE(StrategyUIChannel);
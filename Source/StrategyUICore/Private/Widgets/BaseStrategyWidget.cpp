@@ -4,17 +4,25 @@
 
 #include <Blueprint/WidgetTree.h>
 #include <Editor/WidgetCompilerLog.h>
+#include <Engine/AssetManager.h>
+#include <Engine/StreamableManager.h>
+#include <Engine/World.h>
+#include <Misc/ScopeExit.h>
 #include <Modules/ModuleManager.h>
+#include <TimerManager.h>
 
 #include <AsyncWidgetLoaderSubsystem.h>
 
 #include "Interfaces/IStrategyDataProvider.h"
 #include "Interfaces/IStrategyEntryBase.h"
 #include "Interfaces/IStrategyEntryWidgetProvider.h"
+#include "Interfaces/IStrategyPagedDataProvider.h"
+#include "Settings/StrategyUIProjectSettings.h"
 #include "Strategies/BaseLayoutStrategy.h"
+#include "Subsystems/StrategyEntryPoolSubsystem.h"
 #include "Utils/LogStrategyUI.h"
-#include "Utils/StrategyUIFunctionLibrary.h"
 #include "Utils/StrategyUIGameplayTags.h"
+#include "Utils/StrategyUIStats.h"
 #include "Utils/ReflectedObjectsDebugCategory.h"
 #include "Widgets/SStrategyCanvasPanel.h"
 
@@ -22,6 +30,125 @@
 #define IS_DATA_PROVIDER_READY_AND_VALID(DataProvider) \
 	IsValid(DataProvider) && DataProvider->Implements<UStrategyDataProvider>() && IStrategyDataProvider::Execute_IsProviderReady(DataProvider)
 
+#pragma region FStrategyEntrySlotWindow
+void FStrategyEntrySlotWindow::Reserve(const int32 InCapacity)
+{
+	const int32 DesiredCapacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, MinCapacity)));
+	if (DesiredCapacity <= Slots.Num())
+	{
+		return;
+	}
+
+	if (NumLiveSlots == 0)
+	{
+		Slots.SetNum(DesiredCapacity);
+		SlotGlobalIndices.Init(INDEX_NONE, DesiredCapacity);
+		OccupiedSlots.Init(false, DesiredCapacity);
+		return;
+	}
+
+	// Re-seat the live slots into a bigger ring
+	TArray<FStrategyEntrySlotData> OldSlots = MoveTemp(Slots);
+	TArray<int32> OldGlobalIndices = MoveTemp(SlotGlobalIndices);
+	TBitArray<> OldOccupiedSlots = MoveTemp(OccupiedSlots);
+
+	Slots.SetNum(DesiredCapacity);
+	SlotGlobalIndices.Init(INDEX_NONE, DesiredCapacity);
+	OccupiedSlots.Init(false, DesiredCapacity);
+
+	for (TConstSetBitIterator<> It(OldOccupiedSlots); It; ++It)
+	{
+		const int32 GlobalIndex = OldGlobalIndices[It.GetIndex()];
+		const int32 NewSlotIndex = ToSlotIndex(GlobalIndex);
+		checkf(!OccupiedSlots[NewSlotIndex], TEXT("Slot window collision while growing (global index %d)"), GlobalIndex);
+
+		Slots[NewSlotIndex] = OldSlots[It.GetIndex()];
+		SlotGlobalIndices[NewSlotIndex] = GlobalIndex;
+		OccupiedSlots[NewSlotIndex] = true;
+	}
+}
+
+void FStrategyEntrySlotWindow::Empty()
+{
+	for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+	{
+		Slots[It.GetIndex()].Reset();
+		SlotGlobalIndices[It.GetIndex()] = INDEX_NONE;
+	}
+	OccupiedSlots.SetRange(0, OccupiedSlots.Num(), false);
+	NumLiveSlots = 0;
+}
+
+FStrategyEntrySlotData& FStrategyEntrySlotWindow::FindOrAdd(const int32 GlobalIndex)
+{
+	if (FStrategyEntrySlotData* Existing = Find(GlobalIndex))
+	{
+		return *Existing;
+	}
+
+	int32 SlotIndex = ToSlotIndex(GlobalIndex);
+	if (SlotIndex == INDEX_NONE || OccupiedSlots[SlotIndex])
+	{
+		// Either the ring hasn't been allocated yet, or another live global index is sitting in our slot
+		GrowToFit(GlobalIndex);
+		SlotIndex = ToSlotIndex(GlobalIndex);
+	}
+
+	check(!OccupiedSlots[SlotIndex]);
+	OccupiedSlots[SlotIndex] = true;
+	SlotGlobalIndices[SlotIndex] = GlobalIndex;
+	++NumLiveSlots;
+
+	FStrategyEntrySlotData& SlotData = Slots[SlotIndex];
+	SlotData.Reset();
+	return SlotData;
+}
+
+bool FStrategyEntrySlotWindow::Remove(const int32 GlobalIndex)
+{
+	const int32 SlotIndex = ToSlotIndex(GlobalIndex);
+	if (SlotIndex == INDEX_NONE || !OccupiedSlots[SlotIndex] || SlotGlobalIndices[SlotIndex] != GlobalIndex)
+	{
+		return false;
+	}
+
+	Slots[SlotIndex].Reset();
+	SlotGlobalIndices[SlotIndex] = INDEX_NONE;
+	OccupiedSlots[SlotIndex] = false;
+	--NumLiveSlots;
+	return true;
+}
+
+FString FStrategyEntrySlotWindow::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%d live slots (capacity %d)"), NumLiveSlots, Slots.Num());
+	for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+	{
+		Result += FString::Printf(TEXT("\n\t[%d] => %s"), SlotGlobalIndices[It.GetIndex()], *Slots[It.GetIndex()].ToString());
+	}
+	return Result;
+}
+
+void FStrategyEntrySlotWindow::GrowToFit(const int32 InGlobalIndex)
+{
+	// The ring is collision-free as long as its capacity covers the span from the lowest to the highest live index
+	int32 MinGlobalIndex = InGlobalIndex;
+	int32 MaxGlobalIndex = InGlobalIndex;
+	for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+	{
+		MinGlobalIndex = FMath::Min(MinGlobalIndex, SlotGlobalIndices[It.GetIndex()]);
+		MaxGlobalIndex = FMath::Max(MaxGlobalIndex, SlotGlobalIndices[It.GetIndex()]);
+	}
+
+	const int64 Span = static_cast<int64>(MaxGlobalIndex) - MinGlobalIndex + 1;
+	UE_CLOG(Span > MAX_int16, LogStrategyUI, Warning,
+		TEXT("%hs: Live global indices span %lld entries -- layout strategies are expected to desire a contiguous window."),
+		__FUNCTION__, Span);
+
+	Reserve(FMath::Max(static_cast<int32>(FMath::Min<int64>(Span, MAX_int32 / 2)), Slots.Num() * 2));
+}
+#pragma endregion
+
 #if WITH_EDITOR
 
 void UBaseStrategyWidget::ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const
@@ -147,12 +274,15 @@ void UBaseStrategyWidget::SetDataProvider(UObject* NewProvider)
 	if (IS_DATA_PROVIDER_READY_AND_VALID(DataProvider))
 	{
 		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Unbinding from existing data provider"), __FUNCTION__);
-		IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider)->OnDataProviderUpdatedDelegate.RemoveDynamic(
-			this,
-			&UBaseStrategyWidget::OnDataProviderUpdated
-		);
+		UOnDataProviderUpdatedDelegateWrapper* DelegateWrapper = IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider);
+		DelegateWrapper->OnDataProviderUpdatedDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderUpdated);
+		DelegateWrapper->OnDataProviderDeltaDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderDelta);
+		DelegateWrapper->OnDataProviderPageLoadedDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderPageLoaded);
 	}
 
+	ReleaseAllItemPages(/*bNotifyProvider=*/ true);
+	ItemPageSize = 0;
+
 	DataProvider = NewProvider;
 
 	// Initialize the new provider
@@ -166,12 +296,12 @@ void UBaseStrategyWidget::SetDataProvider(UObject* NewProvider)
 	if (IS_DATA_PROVIDER_READY_AND_VALID(DataProvider))
 	{
 		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Binding to new data provider"), __FUNCTION__);
-		IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider)->OnDataProviderUpdatedDelegate.AddDynamic(
-			this,
-			&UBaseStrategyWidget::OnDataProviderUpdated
-		);
+		UOnDataProviderUpdatedDelegateWrapper* DelegateWrapper = IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider);
+		DelegateWrapper->OnDataProviderUpdatedDelegate.AddUniqueDynamic(this, &UBaseStrategyWidget::OnDataProviderUpdated);
+		DelegateWrapper->OnDataProviderDeltaDelegate.AddUniqueDynamic(this, &UBaseStrategyWidget::OnDataProviderDelta);
+		DelegateWrapper->OnDataProviderPageLoadedDelegate.AddUniqueDynamic(this, &UBaseStrategyWidget::OnDataProviderPageLoaded);
 
-		SetItems(IStrategyDataProvider::Execute_GetDataItems(DataProvider));
+		RefreshFromProvider();
 	}
 }
 
@@ -179,41 +309,83 @@ void UBaseStrategyWidget::Reset()
 {
 	UE_LOG(LogStrategyUI, Verbose, TEXT("%s - %hs: Begin widget reset"), *GetName(), __FUNCTION__);
 
+	bIsHibernating = false;
+	HibernatedProviderDelta.Changes.Reset();
+	bHibernatedProviderRefreshPending = false;
+	StopWatchingHibernatingWorld();
+
 	// Unbind from data provider
 	if (IS_DATA_PROVIDER_READY_AND_VALID(DataProvider))
 	{
-		FOnDataProviderUpdated OnDataProviderUpdated =
-			IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider)->OnDataProviderUpdatedDelegate;
-
-		if (OnDataProviderUpdated.IsAlreadyBound(this, &UBaseStrategyWidget::OnDataProviderUpdated))
+		UOnDataProviderUpdatedDelegateWrapper* DelegateWrapper = IStrategyDataProvider::Execute_GetOnDataProviderUpdated(DataProvider);
+		if (IsValid(DelegateWrapper))
 		{
 			UE_LOG(LogStrategyUI, Verbose, TEXT("%s - %hs: Unbinding from data provider"), *GetName(), __FUNCTION__);
-			OnDataProviderUpdated.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderUpdated);
+			DelegateWrapper->OnDataProviderUpdatedDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderUpdated);
+			DelegateWrapper->OnDataProviderDeltaDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderDelta);
+			DelegateWrapper->OnDataProviderPageLoadedDelegate.RemoveDynamic(this, &UBaseStrategyWidget::OnDataProviderPageLoaded);
 		}
 
+		ReleaseAllItemPages(/*bNotifyProvider=*/ true);
+		ItemPageSize = 0;
 		DataProvider = nullptr;
 	}
 	
-	// Cancel any pending widget loads
+	// Stop warming before the pools go away
+	CancelEntryWidgetPoolWarmUp();
+	CancelProgressiveConstruction();
+
+	// Cancel any pending widget loads (forget them first, the loader may call back while cancelling)
+	const TMap<int32, int32> RequestsToCancel = PendingRequests.GetRequests();
+	PendingRequests.Empty();
 	if (AsyncWidgetLoader)
 	{
-		for (const auto& Pair : GlobalIndexToRequestId)
+		for (const TPair<int32, int32>& Pair : RequestsToCancel)
 		{
 			if (Pair.Value != INDEX_NONE)
 			{
 				AsyncWidgetLoader->CancelRequest(Pair.Value);
 			}
 		}
+	}
 
-		AsyncWidgetLoader->ResetWidgetPools();
+	// Only our own entries go back to the pool, other strategy widgets keep theirs warm
+	ReleaseAllEntryWidgets();
+	RecordLiveSlots();
+
+	// Drop any loaded-but-unflushed batch, those slots are about to go away
+	PendingLoadedGlobalIndices.Reset();
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(LoadBatchFlushTimerHandle);
 	}
-	GlobalIndexToRequestId.Empty();
+	CancelEntryWidgetPrefetch();
+	LastLoadPriorityFocusIndex = INDEX_NONE;
+	ResolvedEntryClassCache.Reset();
 
 	SelectedDataIndices.Empty();
 	FocusedGlobalIndex = 0;
 	FocusedDataIndex   = INDEX_NONE;
 	
-	GlobalIndexToSlotData.Empty();
+	LastDesiredRange = FInt32Range::Empty();
+	LastDesiredIndices.Reset();
+	CurrentDesiredGlobalIndices.Reset();
+	if (LayoutStrategy)
+	{
+		LayoutStrategy->InvalidatePickIndex();
+	}
+	if (StrategyCanvasPanel.IsValid())
+	{
+		StrategyCanvasPanel->ClearChildSlots();
+		StrategyCanvasPanel->SetProxyEntries(TConstArrayView<FStrategyCanvasProxyEntry>());
+	}
+	EntryProxyScratch.Reset();
+
+	DirtyEntryStateGlobalIndices.Reset();
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(EntryStateFlushTimerHandle);
+	}
 	
 	Items.Empty();
 
@@ -235,7 +407,7 @@ void UBaseStrategyWidget::UpdateFocusedIndex(const int32 InNewGlobalFocusIndex)
 		return; // No change
 	}
 
-	const FGameplayTag& FocusedState = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Focused;
+	constexpr EStrategyEntryState FocusedState = EStrategyEntryState::Focused;
 
 	//----------------------------------------------------------
 	// Unfocus old index
@@ -243,17 +415,13 @@ void UBaseStrategyWidget::UpdateFocusedIndex(const int32 InNewGlobalFocusIndex)
 	const int32 OldDataIndex = FocusedDataIndex;
 	if (OldDataIndex != INDEX_NONE)
 	{
-		for (TTuple<int32, FStrategyEntrySlotData>& SlotData : GlobalIndexToSlotData)
+		for (auto It = DataIndexToGlobalIndices.CreateConstKeyIterator(OldDataIndex); It; ++It)
 		{
-			const int32 MappedGlobalIndex = SlotData.Key;
-			const UUserWidget* Widget = SlotData.Value.Widget.Get();
-			if (!Widget) { continue; }
+			const int32 MappedGlobalIndex = It.Value();
+			const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(MappedGlobalIndex);
+			if (!SlotData || !SlotData->Widget.IsValid()) { continue; }
 
-			const int32 MappedDataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(MappedGlobalIndex);
-			if (MappedDataIndex == OldDataIndex)
-			{
-				UpdateEntryInteractionTagState(MappedGlobalIndex, FocusedState, /*bEnable=*/ false);
-			}
+			UpdateEntryInteractionState(MappedGlobalIndex, FocusedState, /*bEnable=*/ false);
 		}
 	}
 
@@ -278,17 +446,13 @@ void UBaseStrategyWidget::UpdateFocusedIndex(const int32 InNewGlobalFocusIndex)
 	const int32 NewDataIndex = FocusedDataIndex;
 	if (NewDataIndex != INDEX_NONE)
 	{
-		for (TTuple<int32, FStrategyEntrySlotData>& SlotData : GlobalIndexToSlotData)
+		for (auto It = DataIndexToGlobalIndices.CreateConstKeyIterator(NewDataIndex); It; ++It)
 		{
-			const int32 MappedGlobalIndex = SlotData.Key;
-			UUserWidget* Widget = SlotData.Value.Widget.Get();
-			if (!Widget) { continue; }
+			const int32 MappedGlobalIndex = It.Value();
+			const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(MappedGlobalIndex);
+			if (!SlotData || !SlotData->Widget.IsValid()) { continue; }
 
-			const int32 MappedDataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(MappedGlobalIndex);
-			if (MappedDataIndex == NewDataIndex)
-			{
-				UpdateEntryInteractionTagState(MappedGlobalIndex, FocusedState, /*bEnable=*/ true);
-			}
+			UpdateEntryInteractionState(MappedGlobalIndex, FocusedState, /*bEnable=*/ true);
 		}
 	}
 }
@@ -301,64 +465,97 @@ void UBaseStrategyWidget::SetSelectedGlobalIndex(const int32 InGlobalIndex, cons
 		return; // out-of-range (e.g., "gap" index)
 	}
 
-	const bool bAlreadySelected = SelectedDataIndices.Contains(DataIndex);
-	const FGameplayTag& SelectedState = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Selected;
+	const bool bAlreadySelected = IsDataIndexSelected(DataIndex);
+	constexpr EStrategyEntryState SelectedState = EStrategyEntryState::Selected;
 
 	// Update the interaction tag for all widgets of this data index
-	for (TTuple<int32, FStrategyEntrySlotData>& SlotData : GlobalIndexToSlotData)
+	for (auto It = DataIndexToGlobalIndices.CreateConstKeyIterator(DataIndex); It; ++It)
 	{
-		const int32 MappedGlobalIndex = SlotData.Key;
-		const UUserWidget* Widget     = SlotData.Value.Widget.Get();
-		if (!Widget) { continue; }
+		const int32 MappedGlobalIndex = It.Value();
+		const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(MappedGlobalIndex);
+		if (!SlotData || !SlotData->Widget.IsValid()) { continue; }
 
-		const int32 MappedDataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(MappedGlobalIndex);
-		if (MappedDataIndex == DataIndex)
-		{
-			UpdateEntryInteractionTagState(MappedGlobalIndex, SelectedState, bShouldBeSelected);
-		}
+		UpdateEntryInteractionState(MappedGlobalIndex, SelectedState, bShouldBeSelected);
 	}
 
 	// Add or remove from the selected set
 	if (bShouldBeSelected && !bAlreadySelected)
 	{
-		SelectedDataIndices.Add(DataIndex);
+		if (DataIndex >= SelectedDataIndices.Num())
+		{
+			SelectedDataIndices.Add(false, FMath::Max(GetItemCount(), DataIndex + 1) - SelectedDataIndices.Num());
+		}
+		SelectedDataIndices[DataIndex] = true;
+
 		UObject* Item = Items.IsValidIndex(DataIndex) ? Items[DataIndex] : nullptr;
 		OnItemSelected.Broadcast(DataIndex, Item);
 	}
 	else if (!bShouldBeSelected && bAlreadySelected)
 	{
-		SelectedDataIndices.Remove(DataIndex);
+		SelectedDataIndices[DataIndex] = false;
 	}
 }
 
+int32 UBaseStrategyWidget::PickGlobalIndexAtScreenPosition(const FVector2D& ScreenPosition) const
+{
+	if (!LayoutStrategy)
+	{
+		return INDEX_NONE;
+	}
+
+	// Entry positions are relative to the panel's center
+	const FVector2D LocalPosition = GetCachedGeometry().AbsoluteToLocal(ScreenPosition) - GetCachedGeometry().GetLocalSize() * 0.5f;
+	return LayoutStrategy->PickGlobalIndexAtLocalPosition(LocalPosition, EntryPickRadius);
+}
+
 void UBaseStrategyWidget::ToggleFocusedIndexSelection()
 {
-	const bool bNewSelected = !SelectedDataIndices.Contains(FocusedDataIndex);
+	const bool bNewSelected = !IsDataIndexSelected(FocusedDataIndex);
 	SetSelectedGlobalIndex(FocusedGlobalIndex, bNewSelected);
 }
+
+TArray<int32> UBaseStrategyWidget::GetSelectedDataIndices() const
+{
+	TArray<int32> Result;
+	for (TConstSetBitIterator<> It(SelectedDataIndices); It; ++It)
+	{
+		Result.Add(It.GetIndex());
+	}
+	return Result;
+}
 #pragma endregion
 
 #pragma region UUserWidget & UWidget Overrides
+void UBaseStrategyWidget::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (!IsDesignTime() && UStrategyUIProjectSettings::Get()->bWarmUpEntryPoolsOnInitialize)
+	{
+		WarmUpEntryWidgetPools();
+	}
+}
+
 void UBaseStrategyWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	if (bIsHibernating)
+	{
+		// Everything is still set up from the last time
+		WakeFromHibernation();
+		return;
+	}
+
 	if (LayoutStrategy)
 	{
+		// The desired window is MaxVisibleEntries wide, plus the deactivated margin on both sides
 		const int32 MaxVisibleEntries = GetLayoutStrategyChecked().MaxVisibleEntries;
-		const int32 InitialCapacity = MaxVisibleEntries + GetLayoutStrategyChecked().NumDeactivatedEntries;
+		const int32 InitialCapacity = FMath::Min(MaxVisibleEntries + 2 * GetLayoutStrategyChecked().NumDeactivatedEntries, MAX_ENTRY_COUNT);
 		GlobalIndexToSlotData.Reserve(InitialCapacity);
 	}
 
-	if (const UGameInstance* GameInstance = GetGameInstance())
-	{
-		AsyncWidgetLoader = GameInstance->GetSubsystem<UAsyncWidgetLoaderSubsystem>();
-
-		if (AsyncWidgetLoader)
-		{
-			AsyncWidgetLoader->SetWidgetCreationContext(GetWorld(), GetOwningPlayer());
-		}
-	}
+	InitializeAsyncWidgetLoader();
 
 	TryCreateDefaultDataProvider();
 
@@ -366,18 +563,146 @@ void UBaseStrategyWidget::NativeConstruct()
 	UpdateReflectedObjectsDebugCategory();
 #endif
 
+	if (bProgressiveConstruction && !IsDesignTime())
+	{
+		BeginProgressiveConstruction();
+	}
+
 	UpdateWidgets();
 }
 
 void UBaseStrategyWidget::NativeDestruct()
 {
-	Reset();
+	if (bHibernateOnDestruct && !IsDesignTime())
+	{
+		Hibernate();
+	}
+	else
+	{
+		Reset();
+	}
 	Super::NativeDestruct();
 }
 
+void UBaseStrategyWidget::Hibernate()
+{
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%s - %hs: Hibernating with %d live slots"), *GetName(), __FUNCTION__, GlobalIndexToSlotData.Num());
+
+	// Loads, page fetches and the provider binding stay live, whatever they deliver is picked up on wake
+	bIsHibernating = true;
+
+	// Dropped without ever being constructed again, the kept state is let go along with the world
+	if (!HibernatingWorldCleanupHandle.IsValid())
+	{
+		HibernatingWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &ThisClass::OnHibernatingWorldCleanup);
+	}
+
+	// Nothing shows what progressive construction builds while we're out of the viewport, the rest is built after waking
+	if (ProgressiveConstructionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressiveConstructionTickerHandle);
+		ProgressiveConstructionTickerHandle.Reset();
+	}
+}
+
+void UBaseStrategyWidget::WakeFromHibernation()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%s - %hs: Waking up, %s"),
+		*GetName(),
+		__FUNCTION__,
+		bHibernatedProviderRefreshPending ? TEXT("refreshing from the provider") : *FString::Printf(TEXT("%d queued provider changes"), HibernatedProviderDelta.Changes.Num())
+	);
+
+	bIsHibernating = false;
+	StopWatchingHibernatingWorld();
+
+	if (bIsConstructingProgressively && !ProgressiveConstructionTickerHandle.IsValid())
+	{
+		ProgressiveConstructionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickProgressiveConstruction));
+	}
+
+	if (bHibernatedProviderRefreshPending)
+	{
+		bHibernatedProviderRefreshPending = false;
+		HibernatedProviderDelta.Changes.Reset();
+		OnDataProviderUpdated();
+	}
+	else if (!HibernatedProviderDelta.Changes.IsEmpty())
+	{
+		const FStrategyDataProviderDelta QueuedDelta = MoveTemp(HibernatedProviderDelta);
+		HibernatedProviderDelta.Changes.Reset();
+		OnDataProviderDelta(QueuedDelta);
+	}
+
+#if WITH_GAMEPLAY_DEBUGGER
+	UpdateReflectedObjectsDebugCategory();
+#endif
+
+	// The Slate panel was rebuilt, this gets the kept entries back into it
+	UpdateWidgets();
+}
+
+void UBaseStrategyWidget::DiscardHibernatedState()
+{
+	if (bIsHibernating)
+	{
+		Reset();
+	}
+}
+
+void UBaseStrategyWidget::OnHibernatingWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World == GetWorld())
+	{
+		DiscardHibernatedState();
+	}
+}
+
+void UBaseStrategyWidget::StopWatchingHibernatingWorld()
+{
+	if (HibernatingWorldCleanupHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldCleanup.Remove(HibernatingWorldCleanupHandle);
+		HibernatingWorldCleanupHandle.Reset();
+	}
+}
+
+void UBaseStrategyWidget::BeginDestroy()
+{
+	// Only what doesn't touch other objects, they may already be unreachable. Hibernated state is given back before
+	// this, by DiscardHibernatedState or the world cleanup.
+	StopWatchingHibernatingWorld();
+	if (ProgressiveConstructionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressiveConstructionTickerHandle);
+		ProgressiveConstructionTickerHandle.Reset();
+	}
+	if (WarmUpTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WarmUpTickerHandle);
+		WarmUpTickerHandle.Reset();
+	}
+	if (WarmUpLoadHandle.IsValid())
+	{
+		WarmUpLoadHandle->CancelHandle();
+		WarmUpLoadHandle.Reset();
+	}
+	Super::BeginDestroy();
+}
+
 TSharedRef<SWidget> UBaseStrategyWidget::RebuildWidget()
 {
 	StrategyCanvasPanel = SNew(SStrategyCanvasPanel);
+
+	// Handles into a previous panel mean nothing to the new one, entries get re-added on the next rebuild
+	GlobalIndexToSlotData.ForEachSlot([](int32, FStrategyEntrySlotData& SlotData)
+	{
+		SlotData.PanelSlotHandle.Reset();
+	});
 	return StrategyCanvasPanel.ToSharedRef();
 }
 
@@ -461,21 +786,20 @@ void UBaseStrategyWidget::OnAsyncWidgetLoaded_Implementation(const int32 Request
 	);
 
 	// Find which global index this request was for
-	int32 GlobalIndex = INT32_MAX;
-	for (const auto& Pair : GlobalIndexToRequestId)
-	{
-		if (Pair.Value == RequestId)
-		{
-			GlobalIndex = Pair.Key;
-			break;
-		}
-	}
-	
-	if (GlobalIndex == INT32_MAX)
+	const int32* RequestedGlobalIndex = PendingRequests.FindGlobalIndex(RequestId);
+	const double RequestTime = RequestedGlobalIndex ? PendingRequests.FindRequestTime(*RequestedGlobalIndex) : 0.0;
+	int32 GlobalIndex = INDEX_NONE;
+	if (!PendingRequests.RemoveByRequestId(RequestId, GlobalIndex))
 	{
 		UE_LOG(LogStrategyUI, Warning, TEXT("Received loaded widget for unknown request %d"), RequestId);
 		return;
 	}
+	RecordAsyncLoadCompleted(RequestTime);
+
+	if (EntryPool)
+	{
+		EntryPool->NotifyWidgetFromLoader(LoadedWidget);
+	}
 
 	ReplacePlaceholderWithActualWidget(GlobalIndex, LoadedWidget);
 }
@@ -489,24 +813,12 @@ void UBaseStrategyWidget::OnAsyncWidgetLoadFailed_Implementation(int32 RequestId
 		FString::Printf(TEXT("%s: Failed to load widget %s"), *GetName(), *WidgetClass.ToString())
 	);
 
-	// Find which global index this request was for
-	int32 GlobalIndex = INT_MAX;
-	for (const auto& Pair : GlobalIndexToRequestId)
-	{
-		if (Pair.Value == RequestId)
-		{
-			GlobalIndex = Pair.Key;
-			break;
-		}
-	}
-
-	if (GlobalIndex == INT_MAX)
+	// Forget the request for whichever global index it was made for
+	int32 GlobalIndex = INDEX_NONE;
+	if (!PendingRequests.RemoveByRequestId(RequestId, GlobalIndex))
 	{
 		UE_LOG(LogStrategyUI, Warning, TEXT("Received failure for unknown request %d"), RequestId);
-		return;
 	}
-
-	GlobalIndexToRequestId.Remove(GlobalIndex);
 }
 
 void UBaseStrategyWidget::OnAsyncWidgetLoadCancelled_Implementation(int32 RequestId,
@@ -518,23 +830,9 @@ void UBaseStrategyWidget::OnAsyncWidgetLoadCancelled_Implementation(int32 Reques
 		FString::Printf(TEXT("%s: Load cancelled for widget %s"), *GetName(), *WidgetClass.ToString())
 	);
 
-	// Find which global index this request was for
-	int32 GlobalIndex = INT_MAX;
-	for (const auto& Pair : GlobalIndexToRequestId)
-	{
-		if (Pair.Value == RequestId)
-		{
-			GlobalIndex = Pair.Key;
-			break;
-		}
-	}
-
-	if (GlobalIndex == INT_MAX)
-	{
-		return;
-	}
-
-	GlobalIndexToRequestId.Remove(GlobalIndex);
+	// Forget the request for whichever global index it was made for
+	int32 GlobalIndex = INDEX_NONE;
+	PendingRequests.RemoveByRequestId(RequestId, GlobalIndex);
 }
 
 void UBaseStrategyWidget::ReplacePlaceholderWithActualWidget(const int32 GlobalIndex, UUserWidget* ActualWidget)
@@ -559,109 +857,241 @@ void UBaseStrategyWidget::ReplacePlaceholderWithActualWidget(const int32 GlobalI
 		OldPlaceholder = SlotData->Widget.Get();
 	}
 	
+	// Setup widget state and data
+	const int32 DataIndex = SlotData->DataIndex;
+	UObject* Item = Items.IsValidIndex(DataIndex) ? Items[DataIndex].Get() : nullptr;
+
+	// The actual widget hasn't been told anything yet, so its next notification carries the full state,
+	// including selection/focus that may have been applied to the placeholder.
+	EStrategyEntryState NewState = SlotData->EntryState;
+	if (IsDataIndexSelected(DataIndex))
+	{
+		NewState |= EStrategyEntryState::Selected;
+	}
+	if (DataIndex != INDEX_NONE && DataIndex == FocusedDataIndex)
+	{
+		NewState |= EStrategyEntryState::Focused;
+	}
+	
 	// Update the slot data with the actual widget
-	FGameplayTagContainer OldTags = SlotData->TagState;
 	SlotData->Widget = ActualWidget;
 	SlotData->CachedSlateWidget = ActualWidget->TakeWidget();
 	SlotData->bIsPlaceholder = false;
-	
-	// Setup widget state and data
-	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
-	const UObject* Item = Items.IsValidIndex(DataIndex) ? Items[DataIndex] : nullptr;
+	SlotData->LastAssignedItem = Item;
+	SlotData->ItemAssignedWidget = ActualWidget;
+	SlotData->NotifiedEntryState = EStrategyEntryState::None;
 	
 	// Assign data to the widget
-	if (ActualWidget->Implements<UStrategyEntryBase>() && Item)
+	if (Item)
 	{
-		IStrategyEntryBase::Execute_BP_OnStrategyEntryItemAssigned(ActualWidget, Item);
+		DispatchEntryItemAssigned(ActualWidget, *SlotData, Item);
 	}
 	
 	// Notify the actual entry widget of its state
-	if (ActualWidget->Implements<UStrategyEntryBase>())
-	{
-		IStrategyEntryBase::Execute_BP_OnStrategyEntryStateTagsChanged(ActualWidget, FGameplayTagContainer(), SlotData->TagState);
-	}
-	
-	// Apply selected state if needed
-	if (SelectedDataIndices.Contains(DataIndex))
-	{
-		const FGameplayTag& SelectedState = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Selected;
-		UpdateEntryInteractionTagState(GlobalIndex, SelectedState, /*bEnable=*/ true);
-	}
-	
-	// Apply focused state if needed
-	if (DataIndex == FocusedDataIndex)
-	{
-		const FGameplayTag& FocusedState = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Focused;
-		UpdateEntryInteractionTagState(GlobalIndex, FocusedState, /*bEnable=*/ true);
-	}
+	NotifyStrategyEntryStateChange(GlobalIndex, NewState);
 	
 	// Clean up the old placeholder
-	if (OldPlaceholder)
+	if (OldPlaceholder && AsyncWidgetLoader)
 	{
-		OldPlaceholder = nullptr;
+		AsyncWidgetLoader->ReleaseWidgetToPool(OldPlaceholder);
 	}
 
 	// Remove the request ID from tracking
-	GlobalIndexToRequestId.Remove(GlobalIndex);
+	PendingRequests.RemoveByGlobalIndex(GlobalIndex);
 	
-	// Rebuild the slate layout with the new widget
-	RebuildSlateForIndices(
-		GetLayoutStrategyChecked().ComputeDesiredGlobalIndices(),
-		/*bForceUpdateWidget=*/false
-	);
+	// Rebuild the slate layout once for everything that finished loading this frame
+	QueueLoadedEntryForBatch(GlobalIndex);
 }
 
-TSoftClassPtr<UUserWidget> UBaseStrategyWidget::ResolveEntryWidgetClass(const int32 GlobalIndex)
+void UBaseStrategyWidget::QueueLoadedEntryForBatch(const int32 GlobalIndex)
 {
-	const UObject* DataItem = nullptr;
-	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
-	if (Items.IsValidIndex(DataIndex))
+	PendingLoadedGlobalIndices.AddUnique(GlobalIndex);
+
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		DataItem = Items[DataIndex];
+		FlushLoadedEntryBatch();
+		return;
 	}
 
-	TSoftClassPtr<UUserWidget> DesiredClass = nullptr;
-	
-	if (DataItem && DataItem->Implements<UStrategyEntryWidgetProvider>())
+	if (!LoadBatchFlushTimerHandle.IsValid())
 	{
-		// A) Attempt to get direct hard class
-		DesiredClass = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetClass(DataItem);
+		LoadBatchFlushTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UBaseStrategyWidget::FlushLoadedEntryBatch);
+	}
+}
 
-		// B) If that fails, attempt to get a soft class
-		if (!DesiredClass)
-		{
-			DesiredClass = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetSoftClass(DataItem);
-		}
+void UBaseStrategyWidget::FlushLoadedEntryBatch()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-		// C) If still none, attempt to get hard class from a widget tag
-		if (!DesiredClass)
-		{
-			const FGameplayTag ItemTag = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetTag(DataItem);
-			if (ItemTag.IsValid() && ItemTag != FGameplayTag::EmptyTag)
-			{
-				if (const TSubclassOf<UUserWidget> FoundClass = UStrategyUIFunctionLibrary::GetWidgetClassForTag(ItemTag))
-				{
-					DesiredClass = *FoundClass;
-				}
-			}
-		}
+	LoadBatchFlushTimerHandle.Invalidate();
+	if (PendingLoadedGlobalIndices.IsEmpty())
+	{
+		return;
+	}
 
-		// D) If still none, attempt to get soft class from the widget tag
-		if (!DesiredClass)
-		{
-			const FGameplayTag ItemTag = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetTag(DataItem);
-			if (ItemTag.IsValid() && ItemTag != FGameplayTag::EmptyTag)
-			{
-				if (const TSoftClassPtr<UUserWidget> FoundClass = UStrategyUIFunctionLibrary::GetWidgetSoftClassForTag(ItemTag))
-				{
-					DesiredClass = FoundClass;
-				}
-			}
+	const TArray<int32> LoadedGlobalIndices = MoveTemp(PendingLoadedGlobalIndices);
+	PendingLoadedGlobalIndices.Reset();
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Flushing %d loaded entry widgets"), __FUNCTION__, LoadedGlobalIndices.Num());
+	OnAsyncWidgetLoadBatchCompleted(LoadedGlobalIndices);
+}
+
+float UBaseStrategyWidget::ComputeEntryLoadPriority(const int32 GlobalIndex) const
+{
+	if (!bPrioritizeEntryLoadsByFocus || !LayoutStrategy)
+	{
+		return 1.f;
+	}
+
+	const int32 Distance = GetLayoutStrategyChecked().GetGlobalIndexDistance(GlobalIndex, FocusedGlobalIndex);
+	return 1.f / (1.f + EntryLoadPriorityFalloff * static_cast<float>(Distance));
+}
+
+void UBaseStrategyWidget::ReprioritizePendingRequests()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!bPrioritizeEntryLoadsByFocus || !AsyncWidgetLoader || PendingRequests.Num() == 0)
+	{
+		LastLoadPriorityFocusIndex = FocusedGlobalIndex;
+		return;
+	}
+
+	if (FocusedGlobalIndex == LastLoadPriorityFocusIndex)
+	{
+		return; // Distances (and so priorities) only change when focus does
+	}
+	LastLoadPriorityFocusIndex = FocusedGlobalIndex;
+
+	// Gather first, re-requesting mutates the table
+	TArray<TPair<int32, float>, TInlineAllocator<32>> RequestsToRequeue;
+	for (const TPair<int32, int32>& Pair : PendingRequests.GetRequests())
+	{
+		const float NewPriority = ComputeEntryLoadPriority(Pair.Key);
+		if (FMath::Abs(NewPriority - PendingRequests.FindPriority(Pair.Key)) >= EntryLoadReprioritizeThreshold)
+		{
+			RequestsToRequeue.Emplace(Pair.Key, NewPriority);
+		}
+	}
+
+	for (const TPair<int32, float>& Requeue : RequestsToRequeue)
+	{
+		const int32 GlobalIndex = Requeue.Key;
+		const int32* FoundRequestId = PendingRequests.FindRequestId(GlobalIndex);
+		if (!FoundRequestId)
+		{
+			continue;
+		}
+
+		// Forget the old request first, the loader may call back while cancelling
+		const int32 OldRequestId = *FoundRequestId;
+		const double RequestTime = PendingRequests.FindRequestTime(GlobalIndex);
+		PendingRequests.RemoveByGlobalIndex(GlobalIndex);
+		AsyncWidgetLoader->CancelRequest(OldRequestId);
+
+		int32 NewRequestId = INDEX_NONE;
+		if (UUserWidget* Widget = AsyncWidgetLoader->RequestWidget_Async(
+			ResolveEntryWidgetClass(GlobalIndex),
+			this,
+			NewRequestId,
+			FOnAsyncWidgetLoadedDynamic(),
+			Requeue.Value
+		); Widget)
+		{
+			// Finished loading in the meantime
+			RecordAsyncLoadCompleted(RequestTime);
+			ReplacePlaceholderWithActualWidget(GlobalIndex, Widget);
+			continue;
+		}
+
+		if (NewRequestId != INDEX_NONE)
+		{
+			PendingRequests.Add(GlobalIndex, NewRequestId, Requeue.Value, RequestTime);
+		}
+	}
+
+	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("%hs: Re-prioritized %d pending loads for focus %d"), __FUNCTION__, RequestsToRequeue.Num(), FocusedGlobalIndex);
+}
+
+void UBaseStrategyWidget::CancelPendingRequests(const TConstArrayView<int32> GlobalIndices)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	for (const int32 GlobalIndex : GlobalIndices)
+	{
+		const int32* FoundRequestId = PendingRequests.FindRequestId(GlobalIndex);
+		if (!FoundRequestId)
+		{
+			continue;
+		}
+
+		// Forget it first, the loader may call back while cancelling
+		const int32 RequestId = *FoundRequestId;
+		PendingRequests.RemoveByGlobalIndex(GlobalIndex);
+		if (RequestId != INDEX_NONE && AsyncWidgetLoader)
+		{
+			AsyncWidgetLoader->CancelRequest(RequestId);
+		}
+	}
+}
+
+void UBaseStrategyWidget::CancelPendingRequestsOutside(const FInt32Range& KeepRange)
+{
+	if (PendingRequests.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<32>> RequestsToCancel;
+	for (const TPair<int32, int32>& Pair : PendingRequests.GetRequests())
+	{
+		if (!KeepRange.Contains(Pair.Key))
+		{
+			RequestsToCancel.Add(Pair.Key);
+		}
+	}
+	CancelPendingRequests(RequestsToCancel);
+}
+
+void UBaseStrategyWidget::OnAsyncWidgetLoadBatchCompleted_Implementation(const TArray<int32>& LoadedGlobalIndices)
+{
+	if (!LayoutStrategy || !StrategyCanvasPanel.IsValid())
+	{
+		return;
+	}
+
+	// Rebuild the slate layout with the new widgets, reusing the window from the last UpdateWidgets
+	RebuildSlateForIndices(CurrentDesiredGlobalIndices, /*bForceUpdateWidget=*/false);
+}
+
+TSoftClassPtr<UUserWidget> UBaseStrategyWidget::ResolveEntryWidgetClass(const int32 GlobalIndex)
+{
+	const UObject* DataItem = nullptr;
+	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
+	if (Items.IsValidIndex(DataIndex))
+	{
+		DataItem = Items[DataIndex];
+	}
+
+	TSoftClassPtr<UUserWidget> DesiredClass = nullptr;
+
+	if (DataItem && DataItem->Implements<UStrategyEntryWidgetProvider>())
+	{
+		// Item class data doesn't change at runtime, so each item is only asked once (until the provider updates)
+		if (const TSoftClassPtr<UUserWidget>* CachedClass = ResolvedEntryClassCache.Find(DataItem))
+		{
+			DesiredClass = *CachedClass;
+		}
+		else
+		{
+			DesiredClass = ResolveEntryWidgetClassForItem(DataItem);
+			ResolvedEntryClassCache.Add(DataItem, DesiredClass);
 		}
 	}
 
 	// E) If none found, fallback to default
-	if (!DesiredClass)
+	if (DesiredClass.IsNull())
 	{
 		if (!ensure(DefaultEntryWidgetClass))
 		{
@@ -675,501 +1105,2034 @@ TSoftClassPtr<UUserWidget> UBaseStrategyWidget::ResolveEntryWidgetClass(const in
 			);
 			return nullptr;
 		}
-		DesiredClass = DefaultEntryWidgetClass;
-	}
-
-	if (!ensureAlwaysMsgf(DesiredClass.IsValid(), TEXT("DesiredClass must be valid!")))
-	{
-		return nullptr;
+		DesiredClass = DefaultEntryWidgetClass.Get();
 	}
 
 	return DesiredClass;
 }
 
-UUserWidget* UBaseStrategyWidget::AcquireEntryWidget(const int32 GlobalIndex)
+TSoftClassPtr<UUserWidget> UBaseStrategyWidget::ResolveEntryWidgetClassForItem(const UObject* DataItem) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	if (!ensureAlwaysMsgf(StrategyCanvasPanel.IsValid(), TEXT("No StrategyCanvasPanel found!")))
+	// A) Attempt to get direct hard class
+	if (const TSubclassOf<UUserWidget> HardClass = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetClass(DataItem))
 	{
-		return nullptr;
+		return HardClass.Get();
 	}
 
-	if (!ensureAlwaysMsgf(AsyncWidgetLoader, TEXT("No AsyncWidgetLoader found!")))
+	// B) If that fails, attempt to get a soft class (loaded or not, the loader takes care of that)
+	if (const TSoftClassPtr<UUserWidget> SoftClass = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetSoftClass(DataItem); !SoftClass.IsNull())
+	{
+		return SoftClass;
+	}
+
+	const FGameplayTag ItemTag = IStrategyEntryWidgetProvider::Execute_GetEntryWidgetTag(DataItem);
+	if (!ItemTag.IsValid())
 	{
 		return nullptr;
 	}
 
-	// (1) If a widget already exists for this index, reuse it
-	if (const FStrategyEntrySlotData* ExistingData = GlobalIndexToSlotData.Find(GlobalIndex))
+	// C) If still none, attempt to get hard class from a widget tag, then D) the soft class, in a single lookup
+	if (const FStrategyUITagWidgetClasses* TagClasses = UStrategyUIProjectSettings::Get()->FindWidgetClassesForTag(ItemTag))
 	{
-		if (ExistingData->IsValid())
+		if (TagClasses->WidgetClass)
 		{
-			UE_LOG(
-				LogStrategyUI, 
-				Verbose, 
-				TEXT("%hs: Reusing widget %s for global index %d"),
-				__FUNCTION__,
-				*ExistingData->Widget->GetName(),
-				GlobalIndex
-			);
-			return ExistingData->Widget.Get();
+			return TagClasses->WidgetClass.Get();
 		}
-		
-		// Check if we have a pending request
-		if (GlobalIndexToRequestId.Contains(GlobalIndex))
+		if (!TagClasses->WidgetSoftClass.IsNull())
 		{
-			// We have a pending request - return the placeholder if it exists
-			return ExistingData->Widget.IsValid() ? ExistingData->Widget.Get() : nullptr;
+			return TagClasses->WidgetSoftClass;
 		}
 	}
 
-	// (2) Determine the data item for this index
-	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
-	UObject* DataItem = Items.IsValidIndex(DataIndex) ? Items[DataIndex] : nullptr;
+	if (UStrategyUIProjectSettings::Get()->bWarnOnMissingClass)
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("%hs: No widget class found for tag [%s] (DataItem=%s)."), __FUNCTION__, *ItemTag.ToString(), *DataItem->GetName());
+	}
+	return nullptr;
+}
 
-	// (3) Decide which widget class to use (could come from data item, or fallback)
-	const TSoftClassPtr<UUserWidget> DesiredClass = ResolveEntryWidgetClass(GlobalIndex);
+void UBaseStrategyWidget::PrefetchEntryWidgets(const TConstArrayView<int32> GlobalIndices)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	// Prepare slot data, even before we have the actual widget
-	FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindOrAdd(GlobalIndex);
-	SlotData.TagState.AddTag(StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Pooled);
-	SlotData.LastAssignedItem = DataItem;
-	
-	int32 RequestId = INDEX_NONE;
-	if (UUserWidget* Widget = AsyncWidgetLoader->RequestWidget_Async(
-		DesiredClass,
-		this,
-		RequestId,
-		FOnAsyncWidgetLoadedDynamic(), // No callback since we're implementing the IAsyncWidgetRequestHandler interface and will handle it in OnAsyncWidgetLoaded_Implementation
-		1.0f  // Default priority
-	); Widget)
+	CancelEntryWidgetPrefetch();
+
+	if (!bPrefetchEntryWidgets || !LayoutStrategy || !AsyncWidgetLoader || MaxPrefetchedEntries <= 0)
 	{
-		SlotData.Widget = Widget;
-		SlotData.CachedSlateWidget = SlotData.Widget->TakeWidget();
-		return SlotData.Widget.Get(); // We have a valid widget already
+		return;
 	}
 
-	if (RequestId == INDEX_NONE)
+	TArray<FSoftObjectPath> ClassesToLoad;
+	int32 NumPrefetched = 0;
+	for (const int32 GlobalIndex : GlobalIndices)
 	{
-		UE_LOG(LogStrategyUI, Error, TEXT("Failed to request widget for global index %d"), GlobalIndex);
-		return nullptr;
-	}
-	GlobalIndexToRequestId.Add(GlobalIndex, RequestId);
+		if (NumPrefetched >= MaxPrefetchedEntries)
+		{
+			break;
+		}
 
-	// (4) If we don't have a proper widget yet, create a placeholder
+		// Already has a widget, or one is on its way
+		if (PendingRequests.ContainsGlobalIndex(GlobalIndex))
+		{
+			continue;
+		}
+		if (const FStrategyEntrySlotData* ExistingData = GlobalIndexToSlotData.Find(GlobalIndex); ExistingData && ExistingData->IsValid())
+		{
+			continue;
+		}
 
-	// Create a placeholder widget if enabled
-	if (bShowLoadingPlaceholders)
-	{
-		const TSubclassOf<UUserWidget> PlaceholderClass = DefaultLoadingPlaceholderClass;
-		if (UUserWidget* PlaceholderWidget = AsyncWidgetLoader->GetOrCreatePooledWidget(PlaceholderClass))
+		const TSoftClassPtr<UUserWidget> DesiredClass = ResolveEntryWidgetClass(GlobalIndex);
+		if (DesiredClass.IsNull())
 		{
-			SlotData.Widget = PlaceholderWidget;
-			SlotData.CachedSlateWidget = PlaceholderWidget->TakeWidget();
-			SlotData.bIsPlaceholder = true; 
+			continue;
+		}
 
-			UpdateEntryLifecycleTagState(GlobalIndex, StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Loading);
+		++NumPrefetched;
+		int32& Count = PrefetchedClassCounts.FindOrAdd(DesiredClass.ToSoftObjectPath());
+		if (Count++ == 0 && !DesiredClass.Get())
+		{
+			ClassesToLoad.Add(DesiredClass.ToSoftObjectPath());
 		}
 	}
 
-	return SlotData.Widget.Get(); // Return the placeholder or nullptr
+	if (PrefetchedClassCounts.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Prefetching %d entry widget classes (%d to load) for %d global indices"),
+		__FUNCTION__,
+		PrefetchedClassCounts.Num(),
+		ClassesToLoad.Num(),
+		NumPrefetched
+	);
+
+	if (ClassesToLoad.IsEmpty())
+	{
+		WarmPrefetchedEntryPools();
+		return;
+	}
+
+	PrefetchLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(ClassesToLoad),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::WarmPrefetchedEntryPools)
+	);
 }
 
-void UBaseStrategyWidget::ReleaseEntryWidget(const int32 GlobalIndex)
+void UBaseStrategyWidget::CancelEntryWidgetPrefetch()
+{
+	if (PrefetchLoadHandle.IsValid())
+	{
+		PrefetchLoadHandle->CancelHandle();
+		PrefetchLoadHandle.Reset();
+	}
+	PrefetchedClassCounts.Reset();
+}
+
+void UBaseStrategyWidget::WarmPrefetchedEntryPools()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	if (!ensureAlwaysMsgf(StrategyCanvasPanel.IsValid(), TEXT("No StrategyCanvasPanel found!")))
+	if (!AsyncWidgetLoader)
 	{
+		CancelEntryWidgetPrefetch();
 		return;
 	}
 
-	// Check for pending requests
-	if (const int32* RequestId = GlobalIndexToRequestId.Find(GlobalIndex))
+	// Taking N widgets and handing them straight back leaves at least N free instances in the pool
+	TArray<UUserWidget*, TInlineAllocator<8>> WarmedWidgets;
+	for (const TPair<FSoftObjectPath, int32>& Pair : PrefetchedClassCounts)
 	{
-		if (*RequestId != INDEX_NONE && AsyncWidgetLoader)
+		const TSubclassOf<UUserWidget> WidgetClass = TSoftClassPtr<UUserWidget>(Pair.Key).Get();
+		if (!WidgetClass)
 		{
-			// Cancel the pending request
-			AsyncWidgetLoader->CancelRequest(*RequestId);
-			GlobalIndexToRequestId.Remove(GlobalIndex);
+			continue; // Failed to load, the regular async request will report it
 		}
+
+		const int32 NumToWarm = FMath::Min(Pair.Value, MaxPrefetchedWidgetsPerClass);
+		for (int32 i = 0; i < NumToWarm; ++i)
+		{
+			if (UUserWidget* Widget = GetOrCreateEntryWidget(WidgetClass))
+			{
+				WarmedWidgets.Add(Widget);
+			}
+		}
+		for (UUserWidget* Widget : WarmedWidgets)
+		{
+			ReleaseEntryWidgetToPool(Widget);
+		}
+		WarmedWidgets.Reset();
 	}
 
-	if (FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex))
+	PrefetchedClassCounts.Reset();
+	PrefetchLoadHandle.Reset();
+}
+
+void UBaseStrategyWidget::InitializeAsyncWidgetLoader()
+{
+	if (const UGameInstance* GameInstance = GetGameInstance())
 	{
-		if (SlotData->IsValid())
+		AsyncWidgetLoader = GameInstance->GetSubsystem<UAsyncWidgetLoaderSubsystem>();
+		EntryPool = GameInstance->GetSubsystem<UStrategyEntryPoolSubsystem>();
+
+		if (AsyncWidgetLoader)
 		{
-			if (UUserWidget* Widget = SlotData->Widget.Get())
-			{
-				if (SlotData->bIsPlaceholder)
-				{
-					// Just remove the placeholder, don't return it to pool
-					SlotData->Widget.Reset();
-					SlotData->CachedSlateWidget.Reset();
-				}
-				else if (AsyncWidgetLoader)
-				{
-					AsyncWidgetLoader->ReleaseWidgetToPool(Widget);
-				}
-				
-				// Transition it back to "Pooled" in IndexToTagStateMap
-				if (GlobalIndexToSlotData.Contains(GlobalIndex))
-				{
-					const FGameplayTagContainer OldState = SlotData->TagState;
-					FGameplayTagContainer PooledState;
-					PooledState.AddTag(StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Pooled);
+			AsyncWidgetLoader->SetWidgetCreationContext(GetWorld(), GetOwningPlayer());
+		}
+	}
+}
 
-					NotifyStrategyEntryStateChange(GlobalIndex, Widget, OldState, PooledState);
-				}
+UUserWidget* UBaseStrategyWidget::GetOrCreateEntryWidget(const TSubclassOf<UUserWidget> WidgetClass)
+{
+	if (EntryPool)
+	{
+		if (UUserWidget* PooledWidget = EntryPool->AcquireWidget(WidgetClass, GetWorld(), GetOwningPlayer(), /*bRecordStats=*/ false))
+		{
+			return PooledWidget;
+		}
+	}
+
+	UUserWidget* Widget = AsyncWidgetLoader ? AsyncWidgetLoader->GetOrCreatePooledWidget(WidgetClass) : nullptr;
+	if (EntryPool)
+	{
+		EntryPool->NotifyWidgetFromLoader(Widget);
+	}
+	return Widget;
+}
+
+void UBaseStrategyWidget::ReleaseEntryWidgetToPool(UUserWidget* Widget)
+{
+	if (EntryPool)
+	{
+		EntryPool->ReleaseWidget(Widget);
+	}
+	else if (AsyncWidgetLoader)
+	{
+		AsyncWidgetLoader->ReleaseWidgetToPool(Widget);
+	}
+}
+
+void UBaseStrategyWidget::ReleaseAllEntryWidgets()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TArray<TPair<UUserWidget*, FStrategyEntrySlotData>, TInlineAllocator<32>> ReleasedEntries;
+	GlobalIndexToSlotData.ForEachSlot([&](int32, FStrategyEntrySlotData& SlotData)
+	{
+		UUserWidget* Widget = SlotData.Widget.Get();
+		if (!Widget)
+		{
+			return;
+		}
+
+		RecordEntryReleased();
+		if (SlotData.bIsPlaceholder)
+		{
+			if (AsyncWidgetLoader)
+			{
+				AsyncWidgetLoader->ReleaseWidgetToPool(Widget);
 			}
+			return;
+		}
+
+		if (bUseRenderTransformMovement)
+		{
+			ApplyEntryRenderTransform(SlotData, true);
 		}
+		ReleaseEntryWidgetToPool(Widget);
+		ReleasedEntries.Emplace(Widget, SlotData);
+	});
+
+	GlobalIndexToSlotData.Empty();
+	DataIndexToGlobalIndices.Empty();
+
+	// Pooled entries don't keep showing whatever they were focused/selected for
+	for (TPair<UUserWidget*, FStrategyEntrySlotData>& Entry : ReleasedEntries)
+	{
+		Entry.Value.EntryState = EStrategyEntryState::Pooled;
+		DispatchEntryStateChange(Entry.Key, Entry.Value);
+	}
+}
+
+void UBaseStrategyWidget::WarmUpEntryWidgetPools(const int32 NumPerClass, const float FrameBudgetMs)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	CancelEntryWidgetPoolWarmUp();
+
+	if (!AsyncWidgetLoader)
+	{
+		// May well be called before construct, e.g. while a loading screen is up
+		InitializeAsyncWidgetLoader();
+	}
+	if (!AsyncWidgetLoader)
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("%hs: No AsyncWidgetLoader found, can't warm up %s"), __FUNCTION__, *GetName());
+		return;
+	}
+
+	const UStrategyUIProjectSettings* Settings = UStrategyUIProjectSettings::Get();
+	const int32 NumWidgetsPerClass = (NumPerClass > 0) ? NumPerClass : Settings->WarmUpWidgetsPerClass;
+	WarmUpFrameBudgetSeconds = ((FrameBudgetMs > 0.f) ? FrameBudgetMs : Settings->WarmUpFrameBudgetMs) / 1000.0;
+
+	TArray<FSoftObjectPath> ClassesToLoad;
+	auto AddTask = [this, NumWidgetsPerClass, &ClassesToLoad](const TSoftClassPtr<UUserWidget>& WidgetClass)
+	{
+		if (WidgetClass.IsNull() || WarmUpTasks.ContainsByPredicate([&WidgetClass](const FEntryPoolWarmUpTask& Task) { return Task.WidgetClass == WidgetClass; }))
+		{
+			return;
+		}
+
+		WarmUpTasks.Add({WidgetClass, NumWidgetsPerClass});
+		if (!WidgetClass.Get())
+		{
+			ClassesToLoad.Add(WidgetClass.ToSoftObjectPath());
+		}
+	};
+
+	AddTask(TSoftClassPtr<UUserWidget>(DefaultEntryWidgetClass.Get()));
+	if (bShowLoadingPlaceholders)
+	{
+		AddTask(TSoftClassPtr<UUserWidget>(DefaultLoadingPlaceholderClass.Get()));
+	}
+	if (Settings->bWarmUpTagMappedClasses)
+	{
+		for (const TPair<FGameplayTag, TSubclassOf<UUserWidget>>& Pair : Settings->TagToWidgetClassMap)
+		{
+			AddTask(TSoftClassPtr<UUserWidget>(Pair.Value.Get()));
+		}
+		for (const TPair<FGameplayTag, TSoftClassPtr<UUserWidget>>& Pair : Settings->TagToWidgetSoftClassMap)
+		{
+			AddTask(Pair.Value);
+		}
+	}
+
+	if (WarmUpTasks.IsEmpty())
+	{
+		return;
+	}
+
+	if (!ClassesToLoad.IsEmpty())
+	{
+		// Tasks for these classes wait on the ticker until they've streamed in
+		WarmUpLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(ClassesToLoad));
+	}
+
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Warming up %d entry widget classes (%d widgets each, %.2fms per frame) for %s"),
+		__FUNCTION__,
+		WarmUpTasks.Num(),
+		NumWidgetsPerClass,
+		WarmUpFrameBudgetSeconds * 1000.0,
+		*GetName()
+	);
+
+	// The core ticker keeps ticking while the world doesn't (loading screens, pause)
+	WarmUpTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickEntryPoolWarmUp));
+}
+
+void UBaseStrategyWidget::CancelEntryWidgetPoolWarmUp()
+{
+	if (WarmUpTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WarmUpTickerHandle);
+		WarmUpTickerHandle.Reset();
+	}
+	if (WarmUpLoadHandle.IsValid())
+	{
+		WarmUpLoadHandle->CancelHandle();
+		WarmUpLoadHandle.Reset();
+	}
+	WarmUpTasks.Reset();
+	ReleaseWarmUpInstances();
+}
+
+bool UBaseStrategyWidget::TickEntryPoolWarmUp(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!AsyncWidgetLoader)
+	{
+		WarmUpTickerHandle.Reset();
+		CancelEntryWidgetPoolWarmUp();
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	bool bCreatedAny = false;
+	for (int32 TaskIndex = 0; TaskIndex < WarmUpTasks.Num();)
+	{
+		FEntryPoolWarmUpTask& Task = WarmUpTasks[TaskIndex];
+		const TSubclassOf<UUserWidget> WidgetClass = Task.WidgetClass.Get();
+		if (!WidgetClass)
+		{
+			if (WarmUpLoadHandle.IsValid() && WarmUpLoadHandle->IsLoadingInProgress())
+			{
+				++TaskIndex; // Still streaming in, come back next frame
+				continue;
+			}
+
+			UE_LOG(LogStrategyUI, Warning, TEXT("%hs: Couldn't load %s, not warming it up"), __FUNCTION__, *Task.WidgetClass.ToString());
+			WarmUpTasks.RemoveAt(TaskIndex);
+			continue;
+		}
+
+		// Always make some progress, even if a single widget blows the budget
+		while (Task.NumRemaining > 0 && (!bCreatedAny || FPlatformTime::Seconds() - StartTime < WarmUpFrameBudgetSeconds))
+		{
+			if (UUserWidget* Widget = GetOrCreateEntryWidget(WidgetClass))
+			{
+				WarmUpInstances.Add(Widget);
+			}
+			--Task.NumRemaining;
+			bCreatedAny = true;
+		}
+
+		if (Task.NumRemaining > 0)
+		{
+			return true; // Out of budget for this frame
+		}
+		WarmUpTasks.RemoveAt(TaskIndex);
+	}
+
+	if (!WarmUpTasks.IsEmpty())
+	{
+		return true; // Only tasks waiting on a load are left
+	}
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Finished warming up %d widgets for %s"), __FUNCTION__, WarmUpInstances.Num(), *GetName());
+
+	ReleaseWarmUpInstances();
+	WarmUpLoadHandle.Reset();
+	WarmUpTickerHandle.Reset();
+	return false;
+}
+
+void UBaseStrategyWidget::ReleaseWarmUpInstances()
+{
+	if (AsyncWidgetLoader)
+	{
+		for (UUserWidget* Widget : WarmUpInstances)
+		{
+			if (Widget)
+			{
+				ReleaseEntryWidgetToPool(Widget);
+			}
+		}
+	}
+	WarmUpInstances.Reset();
+}
+
+void UBaseStrategyWidget::BeginProgressiveConstruction()
+{
+	CancelProgressiveConstruction();
+
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Building entries within %d of focus now, the rest at %.2fms per frame for %s"),
+		__FUNCTION__,
+		ProgressiveConstructionRadius,
+		ProgressiveConstructionFrameBudgetMs,
+		*GetName()
+	);
+
+	bIsConstructingProgressively = true;
+	ProgressiveConstructionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickProgressiveConstruction));
+}
+
+bool UBaseStrategyWidget::TickProgressiveConstruction(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!LayoutStrategy || !AsyncWidgetLoader)
+	{
+		ProgressiveConstructionTickerHandle.Reset();
+		CancelProgressiveConstruction();
+		return false;
+	}
+
+	// Focus may have moved since the last frame. Farthest first, so the closest entry is popped off the back.
+	const UBaseLayoutStrategy& Strategy = GetLayoutStrategyChecked();
+	DeferredConstructionGlobalIndices.Sort([&Strategy, Focus = FocusedGlobalIndex](const int32 A, const int32 B)
+	{
+		return Strategy.GetGlobalIndexDistance(A, Focus) > Strategy.GetGlobalIndexDistance(B, Focus);
+	});
+
+	// Always make some progress, even if a single entry blows the budget
+	const double BudgetSeconds = ProgressiveConstructionFrameBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	bool bBuiltAny = false;
+	while (!DeferredConstructionGlobalIndices.IsEmpty() && (!bBuiltAny || FPlatformTime::Seconds() - StartTime < BudgetSeconds))
+	{
+		const int32 GlobalIndex = DeferredConstructionGlobalIndices.Pop(EAllowShrinking::No);
+		bBuiltAny |= BuildDeferredEntryWidget(GlobalIndex);
+	}
+
+	if (!DeferredConstructionGlobalIndices.IsEmpty())
+	{
+		return true; // Out of budget for this frame
+	}
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Finished progressive construction for %s"), __FUNCTION__, *GetName());
+
+	bIsConstructingProgressively = false;
+	ProgressiveConstructionTickerHandle.Reset();
+	return false;
+}
+
+void UBaseStrategyWidget::CancelProgressiveConstruction()
+{
+	if (ProgressiveConstructionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressiveConstructionTickerHandle);
+		ProgressiveConstructionTickerHandle.Reset();
+	}
+	bIsConstructingProgressively = false;
+	DeferredConstructionGlobalIndices.Reset();
+}
+
+bool UBaseStrategyWidget::BuildDeferredEntryWidget(const int32 GlobalIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+	if (!SlotData || !SlotData->bConstructionDeferred)
+	{
+		return false; // Released (or already built) since it was deferred
+	}
+	SlotData->bConstructionDeferred = false;
+
+	// Either the actual widget replaces it now, or once it's loaded; even without a placeholder widget to show
+	SlotData->bIsPlaceholder = true;
+
+	UUserWidget* Widget = CreateOrRequestEntryWidget(GlobalIndex, ResolveEntryWidgetClass(GlobalIndex));
+	if (!Widget)
+	{
+		return PendingRequests.ContainsGlobalIndex(GlobalIndex); // OnAsyncWidgetLoaded takes it from here
+	}
+
+	ReplacePlaceholderWithActualWidget(GlobalIndex, Widget);
+	return true;
+}
+
+UUserWidget* UBaseStrategyWidget::AcquireEntryWidget(const int32 GlobalIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_AcquireEntryWidget);
+
+	if (!ensureAlwaysMsgf(StrategyCanvasPanel.IsValid(), TEXT("No StrategyCanvasPanel found!")))
+	{
+		return nullptr;
+	}
+
+	if (!ensureAlwaysMsgf(AsyncWidgetLoader, TEXT("No AsyncWidgetLoader found!")))
+	{
+		return nullptr;
+	}
+
+	// (1) If a widget already exists for this index, reuse it
+	if (const FStrategyEntrySlotData* ExistingData = GlobalIndexToSlotData.Find(GlobalIndex))
+	{
+		if (ExistingData->bConstructionDeferred)
+		{
+			// Progressive construction gets to it in its own time, unless it was cancelled since
+			if (!bIsConstructingProgressively)
+			{
+				BuildDeferredEntryWidget(GlobalIndex);
+			}
+			const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+			return SlotData ? SlotData->Widget.Get() : nullptr;
+		}
+
+		if (ExistingData->IsValid())
+		{
+			UE_LOG(
+				LogStrategyUI, 
+				Verbose, 
+				TEXT("%hs: Reusing widget %s for global index %d"),
+				__FUNCTION__,
+				*ExistingData->Widget->GetName(),
+				GlobalIndex
+			);
+			return ExistingData->Widget.Get();
+		}
+		
+		// Check if we have a pending request
+		if (PendingRequests.ContainsGlobalIndex(GlobalIndex))
+		{
+			// We have a pending request - return the placeholder if it exists
+			return ExistingData->Widget.IsValid() ? ExistingData->Widget.Get() : nullptr;
+		}
+	}
+
+	// (2) Determine the data item for this index
+	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
+	UObject* DataItem = Items.IsValidIndex(DataIndex) ? Items[DataIndex] : nullptr;
+
+	// Prepare slot data, even before we have the actual widget
+	FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindOrAdd(GlobalIndex);
+	// Widgets come out of the pool in the "Pooled" state, no need to tell them
+	SlotData.EntryState = StrategyEntryState::WithLifecycle(SlotData.EntryState, EStrategyEntryState::Pooled);
+	SlotData.NotifiedEntryState = SlotData.EntryState;
+	SlotData.LastAssignedItem = DataItem;
+	SetSlotDataIndex(GlobalIndex, SlotData, DataIndex);
+
+	// While constructing progressively, only entries close to focus are built right away
+	if (bIsConstructingProgressively && GetLayoutStrategyChecked().GetGlobalIndexDistance(GlobalIndex, FocusedGlobalIndex) > ProgressiveConstructionRadius)
+	{
+		SlotData.bConstructionDeferred = true;
+		DeferredConstructionGlobalIndices.Add(GlobalIndex);
+		AssignLoadingPlaceholder(GlobalIndex, SlotData);
+		return SlotData.Widget.Get(); // Return the placeholder or nullptr
+	}
+
+	// (3) Decide which widget class to use (could come from data item, or fallback)
+	if (UUserWidget* Widget = CreateOrRequestEntryWidget(GlobalIndex, ResolveEntryWidgetClass(GlobalIndex)))
+	{
+		SlotData.Widget = Widget;
+		SlotData.CachedSlateWidget = SlotData.Widget->TakeWidget();
+		return SlotData.Widget.Get(); // We have a valid widget already
+	}
+
+	if (!PendingRequests.ContainsGlobalIndex(GlobalIndex))
+	{
+		return nullptr; // The request failed
+	}
+
+	// (4) If we don't have a proper widget yet, create a placeholder
+	AssignLoadingPlaceholder(GlobalIndex, SlotData);
+	return SlotData.Widget.Get(); // Return the placeholder or nullptr
+}
+
+UUserWidget* UBaseStrategyWidget::CreateOrRequestEntryWidget(const int32 GlobalIndex, const TSoftClassPtr<UUserWidget>& DesiredClass)
+{
+	// A free entry of a loaded class may be waiting in the shared pool, released by us or another strategy widget
+	UUserWidget* Widget = nullptr;
+	if (EntryPool)
+	{
+		Widget = EntryPool->AcquireWidget(DesiredClass.Get(), GetWorld(), GetOwningPlayer());
+	}
+	const bool bPoolHit = Widget != nullptr;
+
+	int32 RequestId = INDEX_NONE;
+	const float LoadPriority = ComputeEntryLoadPriority(GlobalIndex);
+	if (!Widget)
+	{
+		Widget = AsyncWidgetLoader->RequestWidget_Async(
+			DesiredClass,
+			this,
+			RequestId,
+			FOnAsyncWidgetLoadedDynamic(), // No callback since we're implementing the IAsyncWidgetRequestHandler interface and will handle it in OnAsyncWidgetLoaded_Implementation
+			LoadPriority
+		);
+
+		if (Widget && EntryPool)
+		{
+			EntryPool->NotifyWidgetFromLoader(Widget);
+		}
+	}
+
+	if (Widget)
+	{
+		RecordEntryAcquired(bPoolHit);
+		return Widget;
+	}
+
+	if (RequestId == INDEX_NONE)
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("Failed to request widget for global index %d"), GlobalIndex);
+		return nullptr;
+	}
+	PendingRequests.Add(GlobalIndex, RequestId, LoadPriority);
+	RecordEntryAcquired(/*bPoolHit=*/ false);
+	return nullptr;
+}
+
+void UBaseStrategyWidget::AssignLoadingPlaceholder(const int32 GlobalIndex, FStrategyEntrySlotData& SlotData)
+{
+	if (!bShowLoadingPlaceholders)
+	{
+		return;
+	}
+
+	const TSubclassOf<UUserWidget> PlaceholderClass = DefaultLoadingPlaceholderClass;
+	if (UUserWidget* PlaceholderWidget = AsyncWidgetLoader->GetOrCreatePooledWidget(PlaceholderClass))
+	{
+		SlotData.Widget = PlaceholderWidget;
+		SlotData.CachedSlateWidget = PlaceholderWidget->TakeWidget();
+		SlotData.bIsPlaceholder = true; 
+
+		UpdateEntryLifecycleState(GlobalIndex, EStrategyEntryState::Loading);
+	}
+}
+
+void UBaseStrategyWidget::ReleaseEntryWidget(const int32 GlobalIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_ReleaseEntryWidget);
+
+	if (!ensureAlwaysMsgf(StrategyCanvasPanel.IsValid(), TEXT("No StrategyCanvasPanel found!")))
+	{
+		return;
+	}
+
+	// Check for pending requests
+	if (const int32* FoundRequestId = PendingRequests.FindRequestId(GlobalIndex))
+	{
+		const int32 RequestId = *FoundRequestId;
+		PendingRequests.RemoveByGlobalIndex(GlobalIndex);
+
+		if (RequestId != INDEX_NONE && AsyncWidgetLoader)
+		{
+			// Cancel the pending request
+			AsyncWidgetLoader->CancelRequest(RequestId);
+		}
+	}
+
+	if (FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex))
+	{
+		UUserWidget* ReleasedWidget = nullptr;
+		if (SlotData->IsValid())
+		{
+			if (UUserWidget* Widget = SlotData->Widget.Get())
+			{
+				if (SlotData->bIsPlaceholder)
+				{
+					// Placeholders aren't entries, they go straight back to the loader's pool
+					SlotData->Widget.Reset();
+					SlotData->CachedSlateWidget.Reset();
+					if (AsyncWidgetLoader)
+					{
+						AsyncWidgetLoader->ReleaseWidgetToPool(Widget);
+					}
+				}
+				else
+				{
+					ReleaseEntryWidgetToPool(Widget);
+				}
+				ReleasedWidget = Widget;
+				RecordEntryReleased();
+			}
+		}
+
+		// Don't let our translation follow the widget into its next use
+		if (bUseRenderTransformMovement && ReleasedWidget)
+		{
+			ApplyEntryRenderTransform(*SlotData, true);
+		}
+
+		// Keep what the widget was last told, so it can be transitioned once the slot is gone
+		FStrategyEntrySlotData ReleasedSlotData = *SlotData;
+
+		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Removing slot data for global index %d"), __FUNCTION__, GlobalIndex);
+		SetSlotDataIndex(GlobalIndex, *SlotData, INDEX_NONE);
+		StrategyCanvasPanel->RemoveChildSlot(SlotData->PanelSlotHandle);
+		GlobalIndexToSlotData.Remove(GlobalIndex);
+
+		// Transition it back to "Pooled" (immediately, even when coalescing, the widget may be reused right away)
+		if (ReleasedWidget)
+		{
+			ReleasedSlotData.EntryState = EStrategyEntryState::Pooled;
+			DispatchEntryStateChange(ReleasedWidget, ReleasedSlotData);
+		}
+	}
+}
+
+void UBaseStrategyWidget::ReleaseUndesiredWidgets(const TSet<int32>& DesiredIndices)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TArray<int32, TInlineAllocator<MAX_ENTRY_COUNT>> CurrentIndices;
+	GlobalIndexToSlotData.GenerateKeyArray(CurrentIndices);
+	for (const int32 OldIndex : CurrentIndices)
+	{
+		if (!DesiredIndices.Contains(OldIndex))
+		{
+			ReleaseEntryWidget(OldIndex);
+		}
+	}
+}
+
+void UBaseStrategyWidget::ReleaseUndesiredWidgets(const FInt32Range& DesiredRange)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TArray<int32, TInlineAllocator<MAX_ENTRY_COUNT>> CurrentIndices;
+	GlobalIndexToSlotData.GenerateKeyArray(CurrentIndices);
+	for (const int32 OldIndex : CurrentIndices)
+	{
+		if (!DesiredRange.Contains(OldIndex))
+		{
+			ReleaseEntryWidget(OldIndex);
+		}
+	}
+}
+
+void UBaseStrategyWidget::UpdateEntryWidget(const int32 InGlobalIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("\nStarting UpdateEntryWidget for index %d"), InGlobalIndex);
+	UUserWidget* Widget = AcquireEntryWidget(InGlobalIndex);
+	if (!Widget)
+	{
+		return;
+	}
+
+	FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(InGlobalIndex);
+	if (!SlotData)
+	{
+		return;
+	}
+
+	// The slot's data index was resolved on acquire (and re-resolved whenever the item count changes)
+	UObject* Item = Items.IsValidIndex(SlotData->DataIndex) ? Items[SlotData->DataIndex].Get() : nullptr;
+	if (SlotData->ItemAssignedWidget == Widget && SlotData->LastAssignedItem == Item)
+	{
+		return; // Widget already shows this item
+	}
+
+	SlotData->LastAssignedItem = Item;
+	SlotData->ItemAssignedWidget = Widget;
+	DispatchEntryItemAssigned(Widget, *SlotData, Item);
+}
+
+void UBaseStrategyWidget::SetSlotDataIndex(const int32 GlobalIndex, FStrategyEntrySlotData& SlotData, const int32 NewDataIndex)
+{
+	if (SlotData.DataIndex == NewDataIndex)
+	{
+		return;
+	}
+
+	if (SlotData.DataIndex != INDEX_NONE)
+	{
+		DataIndexToGlobalIndices.RemoveSingle(SlotData.DataIndex, GlobalIndex);
+	}
+
+	SlotData.DataIndex = NewDataIndex;
+
+	if (NewDataIndex != INDEX_NONE)
+	{
+		DataIndexToGlobalIndices.Add(NewDataIndex, GlobalIndex);
+	}
+}
+
+void UBaseStrategyWidget::RebuildDataIndexLookup()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	DataIndexToGlobalIndices.Reset();
+	GlobalIndexToSlotData.ForEachSlot([this](const int32 GlobalIndex, FStrategyEntrySlotData& SlotData)
+	{
+		SlotData.DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
+		if (SlotData.DataIndex != INDEX_NONE)
+		{
+			DataIndexToGlobalIndices.Add(SlotData.DataIndex, GlobalIndex);
+		}
+	});
+}
+
+EStrategyEntryDispatch UBaseStrategyWidget::GetEntryDispatch(FStrategyEntrySlotData& SlotData, const UUserWidget* Widget)
+{
+	if (SlotData.EntryDispatch == EStrategyEntryDispatch::Unresolved || SlotData.EntryDispatchWidget.Get() != Widget)
+	{
+		SlotData.EntryDispatchWidget = const_cast<UUserWidget*>(Widget);
+		SlotData.EntryDispatch = UStrategyEntryWidgetBase::ResolveEntryDispatch(Widget);
+	}
+	return SlotData.EntryDispatch;
+}
+
+void UBaseStrategyWidget::DispatchEntryItemAssigned(UUserWidget* Widget, FStrategyEntrySlotData& SlotData, const UObject* Item)
+{
+	switch (GetEntryDispatch(SlotData, Widget))
+	{
+	case EStrategyEntryDispatch::Native:
+		{
+			UStrategyEntryWidgetBase* NativeEntry = static_cast<UStrategyEntryWidgetBase*>(Widget);
+			if (EnumHasAnyFlags(NativeEntry->GetBlueprintEntryEvents(), EStrategyEntryEvents::ItemAssigned))
+			{
+				RecordBlueprintDispatch();
+			}
+			NativeEntry->NativeOnStrategyEntryItemAssigned(Item);
+			break;
+		}
+	case EStrategyEntryDispatch::Interface:
+		IStrategyEntryBase::Execute_BP_OnStrategyEntryItemAssigned(Widget, Item);
+		RecordBlueprintDispatch();
+		break;
+	default:
+		break;
+	}
+}
+
+void UBaseStrategyWidget::NotifyStrategyEntryStateChange(const int32 GlobalIndex, const EStrategyEntryState NewState)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+	if (!SlotData)
+	{
+		return;
+	}
+	SlotData->EntryState = NewState;
+
+	UWorld* World = GetWorld();
+	if (bCoalesceEntryStateNotifications && World)
+	{
+		// Queue it, the widget gets the net change on the next flush
+		if (!SlotData->bEntryStateDirty && SlotData->NotifiedEntryState != NewState)
+		{
+			SlotData->bEntryStateDirty = true;
+			DirtyEntryStateGlobalIndices.Add(GlobalIndex);
+
+			if (!EntryStateFlushTimerHandle.IsValid())
+			{
+				EntryStateFlushTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UBaseStrategyWidget::FlushEntryStateNotifications);
+			}
+		}
+		return;
+	}
+
+	DispatchEntryStateChange(SlotData->Widget.Get(), *SlotData);
+}
+
+void UBaseStrategyWidget::DispatchEntryStateChange(UUserWidget* Widget, FStrategyEntrySlotData& SlotData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	SlotData.bEntryStateDirty = false;
+
+	const EStrategyEntryState OldState = SlotData.NotifiedEntryState;
+	const EStrategyEntryState NewState = SlotData.EntryState;
+	if (OldState == NewState)
+	{
+		return; // Net change is nothing (e.g. focused then unfocused within one frame)
+	}
+	SlotData.NotifiedEntryState = NewState;
+
+	// Handlers may add/remove slots, so don't touch SlotData past this point
+	const EStrategyEntryDispatch Dispatch = GetEntryDispatch(SlotData, Widget);
+	const EStrategyEntryState FlippedState = OldState ^ NewState;
+	const bool bFocusFlipped = EnumHasAnyFlags(FlippedState, EStrategyEntryState::Focused);
+	const bool bSelectionFlipped = EnumHasAnyFlags(FlippedState, EStrategyEntryState::Selected);
+
+	if (Dispatch == EStrategyEntryDispatch::Native)
+	{
+		UStrategyEntryWidgetBase* NativeEntry = static_cast<UStrategyEntryWidgetBase*>(Widget);
+
+		// Only events a Blueprint implements cost a ProcessEvent
+		const EStrategyEntryEvents BlueprintEvents = NativeEntry->GetBlueprintEntryEvents();
+		const auto RecordIfBlueprint = [this, BlueprintEvents](const EStrategyEntryEvents Event)
+		{
+			if (EnumHasAnyFlags(BlueprintEvents, Event))
+			{
+				RecordBlueprintDispatch();
+			}
+		};
+
+		NativeEntry->NativeOnStrategyEntryStateChanged(OldState, NewState);
+		RecordIfBlueprint(EStrategyEntryEvents::StateTagsChanged);
+		if (bFocusFlipped)
+		{
+			NativeEntry->NativeOnItemFocusChanged(EnumHasAnyFlags(NewState, EStrategyEntryState::Focused));
+			RecordIfBlueprint(EStrategyEntryEvents::FocusChanged);
+		}
+		if (bSelectionFlipped)
+		{
+			NativeEntry->NativeOnItemSelectionChanged(EnumHasAnyFlags(NewState, EStrategyEntryState::Selected));
+			RecordIfBlueprint(EStrategyEntryEvents::SelectionChanged);
+		}
+		return;
+	}
+
+	if (Dispatch != EStrategyEntryDispatch::Interface)
+	{
+		return;
+	}
+
+	IStrategyEntryBase::Execute_BP_OnStrategyEntryStateTagsChanged(
+		Widget,
+		StrategyEntryState::ToTagContainer(OldState),
+		StrategyEntryState::ToTagContainer(NewState)
+	);
+	RecordBlueprintDispatch();
+
+	if (bFocusFlipped)
+	{
+		IStrategyEntryBase::Execute_BP_OnItemFocusChanged(Widget, EnumHasAnyFlags(NewState, EStrategyEntryState::Focused));
+		RecordBlueprintDispatch();
+	}
+	if (bSelectionFlipped)
+	{
+		IStrategyEntryBase::Execute_BP_OnItemSelectionChanged(Widget, EnumHasAnyFlags(NewState, EStrategyEntryState::Selected));
+		RecordBlueprintDispatch();
+	}
+}
+
+void UBaseStrategyWidget::FlushEntryStateNotifications()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(EntryStateFlushTimerHandle);
+	}
+	EntryStateFlushTimerHandle.Invalidate();
+
+	// Take the queue first; anything dirtied by the Blueprint handlers below is delivered on the next flush.
+	// Copied to the stack rather than moved, so the queue keeps its allocation for the next update.
+	const TArray<int32, TInlineAllocator<MAX_ENTRY_COUNT>> GlobalIndicesToFlush(DirtyEntryStateGlobalIndices);
+	DirtyEntryStateGlobalIndices.Reset();
+
+	for (const int32 GlobalIndex : GlobalIndicesToFlush)
+	{
+		FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+		if (!SlotData || !SlotData->bEntryStateDirty)
+		{
+			continue; // Released (and notified) since it was queued
+		}
+		DispatchEntryStateChange(SlotData->Widget.Get(), *SlotData);
+	}
+}
+
+void UBaseStrategyWidget::TryHandlePooledEntryStateTransition(const int32 GlobalIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const bool bShouldBeVisible = GetLayoutStrategyChecked().ShouldBeVisible(GlobalIndex);
+	const EStrategyEntryState DesiredState = bShouldBeVisible
+		? EStrategyEntryState::Active
+		: EStrategyEntryState::Deactivated;
+
+	const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+	if (!SlotData || !SlotData->IsValid())
+	{
+		AcquireEntryWidget(GlobalIndex);
+		SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+	}
+
+	if (!SlotData)
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("Failed to acquire slot data for index %d"), GlobalIndex);
+		return;
+	}
+
+	if (EnumHasAnyFlags(SlotData->EntryState, DesiredState))
+	{
+		return; // Already in correct state
+	}
+
+	UpdateEntryLifecycleState(GlobalIndex, DesiredState);
+}
+
+void UBaseStrategyWidget::UpdateEntryLifecycleState(const int32 GlobalIndex, const EStrategyEntryState NewLifecycleState)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Validate that NewLifecycleState is exactly one lifecycle flag
+	if (!EnumHasAnyFlags(NewLifecycleState, StrategyEntryState::LifecycleMask)
+		|| !FMath::IsPowerOfTwo(static_cast<uint8>(NewLifecycleState))
+		|| EnumHasAnyFlags(NewLifecycleState, StrategyEntryState::InteractionMask))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryLifecycle state: %d"), static_cast<int32>(NewLifecycleState));
+		return;
+	}
+
+	const EStrategyEntryState OldState = GlobalIndexToSlotData.FindOrAdd(GlobalIndex).EntryState;
+	const EStrategyEntryState NewState = StrategyEntryState::WithLifecycle(OldState, NewLifecycleState);
+	if (NewState == OldState)
+	{
+		return; // No change
+	}
+
+	// Notify the widget
+	if (AcquireEntryWidget(GlobalIndex))
+	{
+		NotifyStrategyEntryStateChange(GlobalIndex, NewState);
+	}
+	else if (FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex))
+	{
+		SlotData->EntryState = NewState;
+	}
+}
+
+void UBaseStrategyWidget::UpdateEntryInteractionState(const int32 GlobalIndex, const EStrategyEntryState InteractionState, const bool bEnable)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (InteractionState == EStrategyEntryState::None || EnumHasAnyFlags(InteractionState, ~StrategyEntryState::InteractionMask))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryInteraction state: %d"), static_cast<int32>(InteractionState));
+		return;
+	}
+
+	const EStrategyEntryState OldState = GlobalIndexToSlotData.FindOrAdd(GlobalIndex).EntryState;
+	const EStrategyEntryState NewState = bEnable ? (OldState | InteractionState) : (OldState & ~InteractionState);
+	if (NewState == OldState)
+	{
+		return; // No change
+	}
+
+	if (AcquireEntryWidget(GlobalIndex))
+	{
+		NotifyStrategyEntryStateChange(GlobalIndex, NewState);
+	}
+	else if (FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex))
+	{
+		SlotData->EntryState = NewState;
+	}
+}
+
+void UBaseStrategyWidget::UpdateEntryLifecycleTagState(const int32 GlobalIndex, const FGameplayTag& NewStateTag)
+{
+	const EStrategyEntryState NewState = StrategyEntryState::FromTag(NewStateTag);
+	if (!EnumHasAnyFlags(NewState, StrategyEntryState::LifecycleMask))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryLifecycle tag: %s"), *NewStateTag.ToString());
+		return;
+	}
+	UpdateEntryLifecycleState(GlobalIndex, NewState);
+}
+
+void UBaseStrategyWidget::UpdateEntryInteractionTagState(const int32 GlobalIndex, const FGameplayTag& InteractionTag, const bool bEnable)
+{
+	const EStrategyEntryState InteractionState = StrategyEntryState::FromTag(InteractionTag);
+	if (!EnumHasAnyFlags(InteractionState, StrategyEntryState::InteractionMask))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryInteraction tag: %s"), *InteractionTag.ToString());
+		return;
+	}
+	UpdateEntryInteractionState(GlobalIndex, InteractionState, bEnable);
+}
+
+void UBaseStrategyWidget::UpdateWidgets()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_UpdateWidgets);
+
+	if (InstanceStatName.IsEmpty())
+	{
+		InstanceStatName = FString::Printf(TEXT("UpdateWidgets [%s]"), *GetName());
+#if STATS
+		InstanceUpdateWidgetsStatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_StrategyUI>(InstanceStatName);
+#endif
+	}
+#if STATS
+	FScopeCycleCounter InstanceCycleCounter(InstanceUpdateWidgetsStatId);
+#endif
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*InstanceStatName, StrategyUIChannel);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		GetCurrentFrameStats().UpdateWidgetsMs += static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+		RecordLiveSlots();
+	};
+
+	if (GetItemCount() == 0)
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("%hs called with no items to display!"), __FUNCTION__);
+		return;
+	}
+
+	if (!StrategyCanvasPanel.IsValid())
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No StrategyCanvasPanel found!"), __FUNCTION__);
+		return;
+	}
+
+	if (!LayoutStrategy)
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No LayoutStrategy found!"), __FUNCTION__);
+		return;
+	}
+
+	// Gather desired indices from the layout, preferably as a contiguous window
+	const FInt32Range NewDesiredRange = GetLayoutStrategyChecked().ComputeDesiredGlobalIndexRange();
+	if (!NewDesiredRange.IsEmpty())
+	{
+		// (1) Release old widgets that left the window, cancelling their loads in one go first
+		if (NewDesiredRange != LastDesiredRange)
+		{
+			CancelPendingRequestsOutside(NewDesiredRange);
+			ReleaseUndesiredWidgets(NewDesiredRange);
+
+			CurrentDesiredGlobalIndices.Reset(NewDesiredRange.Size<int32>());
+			for (int32 Idx = NewDesiredRange.GetLowerBoundValue(); Idx < NewDesiredRange.GetUpperBoundValue(); ++Idx)
+			{
+				CurrentDesiredGlobalIndices.Add(Idx);
+			}
+		}
+		LastDesiredRange = NewDesiredRange;
+		LastDesiredIndices.Reset();
+	}
+	else
+	{
+		// Non-contiguous layouts fall back to diffing sets
+		const TSet<int32>& NewDesiredIndices = GetLayoutStrategyChecked().ComputeDesiredGlobalIndices();
+		if (HasNewDesiredIndices(NewDesiredIndices))
+		{
+			ReleaseUndesiredWidgets(NewDesiredIndices);
+
+			// Refill in place rather than assigning, so both keep their allocations frame to frame
+			CurrentDesiredGlobalIndices.Reset(NewDesiredIndices.Num());
+			LastDesiredIndices.Reset();
+			for (const int32 Idx : NewDesiredIndices)
+			{
+				CurrentDesiredGlobalIndices.Add(Idx);
+				LastDesiredIndices.Add(Idx);
+			}
+		}
+		LastDesiredRange = FInt32Range::Empty();
+	}
+
+	// Paged providers only have items for the pages the window maps to
+	if (IsUsingPagedDataProvider())
+	{
+		RequestItemPagesForWindow();
+	}
+
+	// (2) Acquire entering widgets and handle lifecycle transitions.
+	// Entries that are already live and showing the right item early out without notifying anything.
+	for (const int32 Idx : CurrentDesiredGlobalIndices)
+	{
+		if (ShouldUseEntryProxy(Idx))
+		{
+			continue; // Drawn by the panel, RebuildSlateForIndices releases any widget it had
+		}
+		TryHandlePooledEntryStateTransition(Idx);
+		UpdateEntryWidget(Idx);
+	}
+
+	// Loads still in flight follow focus
+	ReprioritizePendingRequests();
+
+	// (3) Push positions to the panel (only if something actually moved or changed)
+	RebuildSlateForIndices(CurrentDesiredGlobalIndices, /*bForceUpdateWidget=*/false);
+
+	// (4) Deliver this update's state changes, one per entry
+	if (!DirtyEntryStateGlobalIndices.IsEmpty())
+	{
+		FlushEntryStateNotifications();
+	}
+}
+
+bool UBaseStrategyWidget::HasNewDesiredIndices(const TSet<int32>& NewIndices) const
+{
+	const bool bAreSetsIdentical = (LastDesiredIndices.Num() == NewIndices.Num()
+	   && LastDesiredIndices.Includes(NewIndices)
+	   && NewIndices.Includes(LastDesiredIndices)
+	   && LastDesiredIndices.Num() > 0
+	   && NewIndices.Num() > 0);
+	return !bAreSetsIdentical;
+}
+
+void UBaseStrategyWidget::RebuildSlateForIndices(const TSet<int32>& InIndices, const bool bForceUpdateWidget)
+{
+	TArray<int32, TInlineAllocator<MAX_ENTRY_COUNT>> Indices;
+	Indices.Reserve(InIndices.Num());
+	for (const int32 Idx : InIndices)
+	{
+		Indices.Add(Idx);
+	}
+	RebuildSlateForIndices(Indices, bForceUpdateWidget);
+}
+
+void UBaseStrategyWidget::RebuildSlateForIndices(const TConstArrayView<int32> InIndices, const bool bForceUpdateWidget)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_RebuildSlateForIndices);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		GetCurrentFrameStats().RebuildSlateMs += static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+	};
+
+	if (!StrategyCanvasPanel.IsValid())
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No StrategyCanvasPanel found!"), __FUNCTION__);
+		return;
+	}
+
+	// Evaluate all positions in one batch when the indices form a contiguous window (always the case for range-based layouts)
+	bool bIsContiguousWindow = !InIndices.IsEmpty();
+	for (int32 i = 1; bIsContiguousWindow && i < InIndices.Num(); ++i)
+	{
+		bIsContiguousWindow = InIndices[i] == InIndices[0] + i;
+	}
+
+	TArray<FVector2D, TInlineAllocator<MAX_ENTRY_COUNT>> BatchedPositions;
+	BatchedPositions.SetNumUninitialized(InIndices.Num());
+	if (bIsContiguousWindow)
+	{
+		const FInt32Range WindowRange(InIndices[0], InIndices[0] + InIndices.Num());
+		if (!GetPrecomputedItemPositions(WindowRange, BatchedPositions))
+		{
+			GetLayoutStrategyChecked().ComputeItemPositions(WindowRange, BatchedPositions);
+		}
+	}
+	else
+	{
+		for (int32 i = 0; i < InIndices.Num(); ++i)
+		{
+			BatchedPositions[i] = GetLayoutStrategyChecked().GetItemPosition(InIndices[i]);
+		}
+	}
+
+	// Picking sees what the panel shows (a no-op when nothing moved)
+	GetLayoutStrategyChecked().UpdatePickIndex(InIndices, BatchedPositions);
+
+	EntryProxyScratch.Reset();
+
+	// Iterate once over all global indices that should be shown, patching only the panel slots that changed.
+	for (int32 i = 0; i < InIndices.Num(); ++i)
+	{
+		const int32 GlobalIndex = InIndices[i];
+
+		// Optionally force an update/re-acquisition of the entry widget.
+		if (bForceUpdateWidget)
+		{
+			UpdateEntryWidget(GlobalIndex);
+		}
+
+		// Compute the final position for this entry
+		const FVector2D ItemLocalPos = BatchedPositions[i];
+
+		// Proxies skip the widget side entirely
+		if (ShouldUseEntryProxy(GlobalIndex))
+		{
+			if (GlobalIndexToSlotData.Contains(GlobalIndex))
+			{
+				ReleaseEntryWidget(GlobalIndex);
+			}
+
+			FStrategyCanvasProxyEntry& Proxy = EntryProxyScratch.AddDefaulted_GetRef();
+			Proxy.Position = ItemLocalPos;
+			MakeEntryProxy(GlobalIndex, Proxy);
+			continue;
+		}
+		// For now, we use a fixed depth. @TODO: Implement depth handling in the layout strategy.
+		constexpr float DepthValue = 0.f;
+
+		// Find the slot data for this global index.
+		FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+		if (!SlotData)
+		{
+			// If none exists, try to acquire the widget and then retrieve the slot data.
+			AcquireEntryWidget(GlobalIndex);
+			SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+			if (!SlotData)
+			{
+				UE_LOG(LogStrategyUI, Warning, TEXT("Could not create slot for index %d"), GlobalIndex);
+				continue;
+			}
+		}
+
+		// Update the slot data with the computed position and depth.
+		UE_LOG(
+			LogStrategyUI,
+			VeryVerbose,
+			TEXT("%hs: Updating slot data for global index %d at position %s"),
+			__FUNCTION__,
+			GlobalIndex,
+			*ItemLocalPos.ToString()
+		);
+		SlotData->Position = ItemLocalPos;
+		SlotData->Depth = DepthValue;
+
+		const TSharedPtr<SWidget> UnderlyingSlateWidget = SlotData->IsValid() ? SlotData->CachedSlateWidget : nullptr;
+		if (!UnderlyingSlateWidget.IsValid())
+		{
+			// Nothing (yet) to show, make sure nothing stale is left in the panel
+			StrategyCanvasPanel->RemoveChildSlot(SlotData->PanelSlotHandle);
+			SlotData->PanelSlotHandle.Reset();
+			continue;
+		}
+
+		// In render transform mode every entry is anchored at the panel center and moved by its own transform instead
+		const FVector2D PanelPosition = bUseRenderTransformMovement ? FVector2D::ZeroVector : SlotData->Position;
+		if (bUseRenderTransformMovement)
+		{
+			ApplyEntryRenderTransform(*SlotData);
+		}
+
+		if (StrategyCanvasPanel->IsValidChildSlot(SlotData->PanelSlotHandle))
+		{
+			// Both are no-ops when nothing changed; a move only invalidates paint
+			StrategyCanvasPanel->SetChildSlotWidget(SlotData->PanelSlotHandle, UnderlyingSlateWidget.ToSharedRef());
+			StrategyCanvasPanel->SetChildSlotPosition(SlotData->PanelSlotHandle, PanelPosition, SlotData->Depth);
+		}
+		else
+		{
+			FStrategyCanvasSlotData_Minimal MinimalData;
+			MinimalData.Position = PanelPosition;
+			MinimalData.Depth = SlotData->Depth;
+			MinimalData.Widget = UnderlyingSlateWidget;
+			UE_LOG(
+				LogStrategyUI,
+				VeryVerbose,
+				TEXT("%hs: Adding panel slot for global index %d at position %s"),
+				__FUNCTION__,
+				GlobalIndex,
+				*ItemLocalPos.ToString()
+			);
+			SlotData->PanelSlotHandle = StrategyCanvasPanel->AddChildSlot(MinimalData);
+		}
+	}
+
+	StrategyCanvasPanel->SetProxyEntries(EntryProxyScratch);
+}
+
+bool UBaseStrategyWidget::ShouldUseEntryProxy(const int32 GlobalIndex) const
+{
+	// Without proxies the window is clamped to MAX_ENTRY_COUNT, every entry in it gets a real widget
+	if (!bUseEntryProxies)
+	{
+		return false;
+	}
+
+	// Hard cap on real widgets for windows up to MAX_WINDOW_ENTRY_COUNT, closest to focus win
+	constexpr int32 MaxFullWidgetFocusDistance = (MAX_ENTRY_COUNT - 1) / 2;
+
+	const UBaseLayoutStrategy& Strategy = GetLayoutStrategyChecked();
+	const int32 FocusDistance = Strategy.GetGlobalIndexDistance(GlobalIndex, FocusedGlobalIndex);
+	if (FocusDistance > MaxFullWidgetFocusDistance)
+	{
+		return true;
+	}
+
+	if (bProxyDeactivatedEntries && !Strategy.ShouldBeVisible(GlobalIndex))
+	{
+		return true;
+	}
+
+	return FocusDistance > FullWidgetFocusDistance;
+}
+
+void UBaseStrategyWidget::MakeEntryProxy(const int32 GlobalIndex, FStrategyCanvasProxyEntry& OutProxy) const
+{
+	OutProxy.Size = EntryProxySize;
+	OutProxy.Brush = &EntryProxyBrush;
+
+	// Gap entries have no item to stand in for
+	const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
+	if (!Items.IsValidIndex(DataIndex))
+	{
+		OutProxy.Brush = nullptr;
+	}
+	else if (IsDataIndexSelected(DataIndex))
+	{
+		OutProxy.Tint = EntryProxySelectedTint;
+	}
+}
+
+void UBaseStrategyWidget::ApplyEntryRenderTransform(const FStrategyEntrySlotData& SlotData, const bool bClear) const
+{
+	const TSharedPtr<SWidget>& SlateWidget = SlotData.CachedSlateWidget;
+	if (!SlateWidget.IsValid())
+	{
+		return;
+	}
+
+	const TOptional<FSlateRenderTransform>& CurrentTransform = SlateWidget->GetRenderTransform();
+	if (bClear)
+	{
+		if (CurrentTransform.IsSet())
+		{
+			SlateWidget->SetRenderTransform(TOptional<FSlateRenderTransform>());
+		}
+		return;
+	}
+
+	const FVector2f Translation(SlotData.Position);
+	if (!CurrentTransform.IsSet() || !CurrentTransform->GetTranslation().Equals(Translation) || !CurrentTransform->GetMatrix().IsIdentity())
+	{
+		// Only the entry itself is invalidated, the panel and its siblings keep their cached layout and draw elements
+		SlateWidget->SetRenderTransform(FSlateRenderTransform(Translation));
+	}
+}
+#pragma endregion EntryWidgetsPoolAndHandling
+
+#pragma region UBaseStrategyWidget - Internal Implementations
+void UBaseStrategyWidget::SetItems_Internal_Implementation(const TArray<UObject*>& InItems)
+{
+	Items = InItems;
+
+	// Forget classes resolved for items that have since been destroyed
+	for (auto It = ResolvedEntryClassCache.CreateIterator(); It; ++It)
+	{
+		if (It->Key.IsStale())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Drop selection bits for items that no longer exist
+	if (SelectedDataIndices.Num() > GetItemCount())
+	{
+		SelectedDataIndices.RemoveAt(GetItemCount(), SelectedDataIndices.Num() - GetItemCount());
+	}
+
+	if (GetItemCount() <= 0)
+	{
+		UE_LOG(LogStrategyUI, Log, TEXT("%hs called with no items to display!"), __FUNCTION__);
+		return;
+	}
+
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Initializing %s as strategy host for %d items"),
+		__FUNCTION__,
+		*GetName(),
+		GetItemCount()
+	);
+
+	GetLayoutStrategyChecked().InitializeStrategy(this);
+
+	// The item count feeds into GlobalIndexToDataIndex, so existing slots may now map elsewhere
+	RebuildDataIndexLookup();
+	UpdateWidgets();
+}
+#pragma endregion
+
+#pragma region UBaseStrategyWidget - Data Provider
+void UBaseStrategyWidget::OnDataProviderUpdated()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Data provider updated"), __FUNCTION__);
+
+	if (bIsHibernating)
+	{
+		// Refetching everything on wake covers any deltas queued so far
+		bHibernatedProviderRefreshPending = true;
+		HibernatedProviderDelta.Changes.Reset();
+		return;
+	}
+
+	// The provider may have changed what its items want to be displayed with
+	ResolvedEntryClassCache.Reset();
+	RefreshFromProvider();
+}
+
+void UBaseStrategyWidget::OnDataProviderDelta(const FStrategyDataProviderDelta& Delta)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Data provider sent %d changes"), __FUNCTION__, Delta.Changes.Num());
+
+	if (Delta.Changes.IsEmpty() || !LayoutStrategy)
+	{
+		return;
+	}
+
+	if (bIsHibernating)
+	{
+		if (!bHibernatedProviderRefreshPending)
+		{
+			HibernatedProviderDelta.Changes.Append(Delta.Changes);
+		}
+		return;
+	}
+
+	if (!(IS_DATA_PROVIDER_READY_AND_VALID(DataProvider)))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("%hs: Data provider is not ready or valid!"), __FUNCTION__);
+		return;
+	}
+
+	const UObject* PreviousFocusedItem = Items.IsValidIndex(FocusedDataIndex) ? Items[FocusedDataIndex].Get() : nullptr;
+
+	TSet<const UObject*> ChangedItems;
+	if (!ApplyDataProviderDelta(Delta, ChangedItems) || GetItemCount() <= 0)
+	{
+		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Delta can't be applied to the current items, refreshing all of them"), __FUNCTION__);
+		OnDataProviderUpdated();
+		return;
+	}
+
+	const bool bStructuralChange = Delta.HasStructuralChanges();
+	if (bStructuralChange)
+	{
+		if (IsUsingPagedDataProvider())
+		{
+			// Page boundaries moved along with the items, refetch what the window needs
+			ReleaseAllItemPages(/*bNotifyProvider=*/ false);
+			for (TObjectPtr<UObject>& Item : Items)
+			{
+				Item = nullptr;
+			}
+		}
+
+		// The item count feeds into the strategy and GlobalIndexToDataIndex, the pointer/focus state is left alone
+		GetLayoutStrategyChecked().InitializeStrategy(this);
+		RebuildDataIndexLookup();
+		if (IsUsingPagedDataProvider())
+		{
+			RequestItemPagesForWindow();
+		}
+
+		FocusedDataIndex = FocusedGlobalIndex != INDEX_NONE
+			? GetLayoutStrategyChecked().GlobalIndexToDataIndex(FocusedGlobalIndex)
+			: INDEX_NONE;
+
+		UObject* FocusedItem = Items.IsValidIndex(FocusedDataIndex) ? Items[FocusedDataIndex].Get() : nullptr;
+		if (FocusedItem != PreviousFocusedItem)
+		{
+			OnItemFocused.Broadcast(FocusedItem ? FocusedDataIndex : INDEX_NONE, FocusedItem);
+		}
+	}
+
+	// Find the live entries that now show a different item, or whose item changed in place
+	TArray<int32, TInlineAllocator<32>> StaleGlobalIndices;
+	GlobalIndexToSlotData.ForEachSlot([&](const int32 GlobalIndex, const FStrategyEntrySlotData& SlotData)
+	{
+		const UObject* Item = Items.IsValidIndex(SlotData.DataIndex) ? Items[SlotData.DataIndex].Get() : nullptr;
+		if (bStructuralChange || Item != SlotData.LastAssignedItem.Get() || ChangedItems.Contains(Item))
+		{
+			StaleGlobalIndices.Add(GlobalIndex);
+		}
+	});
+
+	bool bReleasedAny = false;
+	for (const int32 GlobalIndex : StaleGlobalIndices)
+	{
+		const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+		if (!SlotData)
+		{
+			continue;
+		}
+
+		const int32 DataIndex = SlotData->DataIndex;
+		const UObject* Item = Items.IsValidIndex(DataIndex) ? Items[DataIndex].Get() : nullptr;
+		if (RefreshEntryItem(GlobalIndex, ChangedItems.Contains(Item)))
+		{
+			bReleasedAny = true;
+			continue;
+		}
+
+		if (bStructuralChange)
+		{
+			// Entries that now show another data index take on its selection/focus
+			UpdateEntryInteractionState(GlobalIndex, EStrategyEntryState::Selected, IsDataIndexSelected(DataIndex));
+			UpdateEntryInteractionState(GlobalIndex, EStrategyEntryState::Focused, DataIndex != INDEX_NONE && DataIndex == FocusedDataIndex);
+		}
+
+		if (!bStructuralChange)
+		{
+			UpdateEntryWidget(GlobalIndex);
+		}
+	}
+
+	if (bStructuralChange || bReleasedAny)
+	{
+		UpdateWidgets();
+	}
+	else if (!DirtyEntryStateGlobalIndices.IsEmpty())
+	{
+		FlushEntryStateNotifications();
+	}
+}
+
+bool UBaseStrategyWidget::ApplyDataProviderDelta(const FStrategyDataProviderDelta& Delta, TSet<const UObject*>& OutChangedItems)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Moves a run of bits so it starts at DestinationIndex once removed
+	auto MoveBits = [](TBitArray<>& Bits, const int32 StartIndex, const int32 Count, const int32 DestinationIndex)
+	{
+		TArray<bool, TInlineAllocator<64>> MovedBits;
+		MovedBits.Reserve(Count);
+		for (int32 Offset = 0; Offset < Count; ++Offset)
+		{
+			MovedBits.Add(Bits[StartIndex + Offset]);
+		}
+		Bits.RemoveAt(StartIndex, Count);
+		Bits.Insert(false, DestinationIndex, Count);
+		for (int32 Offset = 0; Offset < Count; ++Offset)
+		{
+			Bits[DestinationIndex + Offset] = MovedBits[Offset];
+		}
+	};
+
+	// Check every change against the item count it applies to before touching anything, so a delta that gets
+	// rejected leaves Items and the selection as they were for the full refresh
+	int32 ItemCount = GetItemCount();
+	for (const FStrategyDataProviderChange& Change : Delta.Changes)
+	{
+		const int32 StartIndex = Change.StartIndex;
+		const int32 Count = Change.Count;
+		if (StartIndex < 0 || Count <= 0)
+		{
+			return false;
+		}
+
+		switch (Change.Type)
+		{
+		case EStrategyDataProviderChangeType::Inserted:
+			if (StartIndex > ItemCount)
+			{
+				return false;
+			}
+			ItemCount += Count;
+			break;
+
+		case EStrategyDataProviderChangeType::Removed:
+			if (StartIndex + Count > ItemCount)
+			{
+				return false;
+			}
+			ItemCount -= Count;
+			break;
+
+		case EStrategyDataProviderChangeType::Moved:
+			if (StartIndex + Count > ItemCount
+				|| Change.DestinationIndex < 0 || Change.DestinationIndex > ItemCount - Count)
+			{
+				return false;
+			}
+			break;
+
+		case EStrategyDataProviderChangeType::Changed:
+			if (StartIndex + Count > ItemCount)
+			{
+				return false;
+			}
+			break;
+		}
+	}
 
-		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Removing slot data for global index %d"), __FUNCTION__, GlobalIndex);
-		SlotData->Reset();
-		GlobalIndexToSlotData.Remove(GlobalIndex);
+	if (ItemCount != IStrategyDataProvider::Execute_GetDataItemCount(DataProvider))
+	{
+		return false;
 	}
-}
 
-void UBaseStrategyWidget::ReleaseUndesiredWidgets(const TSet<int32>& DesiredIndices)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	// Keep the selection bits parallel to Items while shuffling them around
+	if (SelectedDataIndices.Num() < GetItemCount())
+	{
+		SelectedDataIndices.Add(false, GetItemCount() - SelectedDataIndices.Num());
+	}
+	else if (SelectedDataIndices.Num() > GetItemCount())
+	{
+		SelectedDataIndices.RemoveAt(GetItemCount(), SelectedDataIndices.Num() - GetItemCount());
+	}
 
-	TArray<int32> CurrentIndices;
-	GlobalIndexToSlotData.GenerateKeyArray(CurrentIndices);
-	for (const int32 OldIndex : CurrentIndices)
+	// Items to fetch from the provider once every change is applied (indices refer to its final items)
+	TBitArray<> NeedsFetch(false, GetItemCount());
+
+	for (const FStrategyDataProviderChange& Change : Delta.Changes)
 	{
-		if (!DesiredIndices.Contains(OldIndex))
+		const int32 StartIndex = Change.StartIndex;
+		const int32 Count = Change.Count;
+		switch (Change.Type)
 		{
-			ReleaseEntryWidget(OldIndex);
+		case EStrategyDataProviderChangeType::Inserted:
+			Items.InsertZeroed(StartIndex, Count);
+			SelectedDataIndices.Insert(false, StartIndex, Count);
+			NeedsFetch.Insert(true, StartIndex, Count);
+			break;
+
+		case EStrategyDataProviderChangeType::Removed:
+			Items.RemoveAt(StartIndex, Count, EAllowShrinking::No);
+			SelectedDataIndices.RemoveAt(StartIndex, Count);
+			NeedsFetch.RemoveAt(StartIndex, Count);
+			break;
+
+		case EStrategyDataProviderChangeType::Moved:
+		{
+			TArray<TObjectPtr<UObject>, TInlineAllocator<64>> MovedItems(Items.GetData() + StartIndex, Count);
+			Items.RemoveAt(StartIndex, Count, EAllowShrinking::No);
+			Items.Insert(MovedItems.GetData(), Count, Change.DestinationIndex);
+			MoveBits(SelectedDataIndices, StartIndex, Count, Change.DestinationIndex);
+			MoveBits(NeedsFetch, StartIndex, Count, Change.DestinationIndex);
+			break;
 		}
-	}
-}
 
-void UBaseStrategyWidget::UpdateEntryWidget(const int32 InGlobalIndex)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+		case EStrategyDataProviderChangeType::Changed:
+			NeedsFetch.SetRange(StartIndex, Count, true);
+			break;
+		}
+	}
 
-	UE_LOG(LogStrategyUI, Verbose, TEXT("\nStarting UpdateEntryWidget for index %d"), InGlobalIndex);
-	UUserWidget* Widget = AcquireEntryWidget(InGlobalIndex);
-	if (Widget && Widget->Implements<UStrategyEntryBase>())
+	const bool bStructuralChange = Delta.HasStructuralChanges();
+	for (TConstSetBitIterator<> It(NeedsFetch); It; ++It)
 	{
-		const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(InGlobalIndex);
-		const UObject* Item = Items.IsValidIndex(DataIndex) ? Items[DataIndex] : nullptr;
-		// (Optional) re‐assign if needed
-		IStrategyEntryBase::Execute_BP_OnStrategyEntryItemAssigned(Widget, Item);
-	}
-}
+		const int32 DataIndex = It.GetIndex();
 
-void UBaseStrategyWidget::NotifyStrategyEntryStateChange(
-	const int32 GlobalIndex,
-	UUserWidget* Widget,
-	const FGameplayTagContainer& OldState,
-	const FGameplayTagContainer& NewState
-)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+		// Paged providers only hand out resident pages, the rest is fetched once the window gets there
+		if (IsUsingPagedDataProvider() && (bStructuralChange || !ResidentItemPages.Contains(DataIndex / ItemPageSize)))
+		{
+			continue;
+		}
 
-	if (NewState != OldState)
-	{
-		FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindChecked(GlobalIndex);
-		SlotData.TagState = NewState;
+		if (const UObject* OldItem = Items[DataIndex])
+		{
+			OutChangedItems.Add(OldItem);
+			ResolvedEntryClassCache.Remove(OldItem);
+		}
 
-		if (Widget->Implements<UStrategyEntryBase>())
+		Items[DataIndex] = IStrategyDataProvider::Execute_GetDataItemAt(DataProvider, DataIndex);
+		if (const UObject* NewItem = Items[DataIndex])
 		{
-			IStrategyEntryBase::Execute_BP_OnStrategyEntryStateTagsChanged(Widget, OldState, NewState);
+			// The provider may have changed what this item wants to be displayed with
+			OutChangedItems.Add(NewItem);
+			ResolvedEntryClassCache.Remove(NewItem);
 		}
 	}
+
+	return true;
 }
 
-void UBaseStrategyWidget::TryHandlePooledEntryStateTransition(const int32 GlobalIndex)
+bool UBaseStrategyWidget::RefreshEntryItem(const int32 GlobalIndex, const bool bForceReassign)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-
-	const bool bShouldBeVisible = GetLayoutStrategyChecked().ShouldBeVisible(GlobalIndex);
-	const FGameplayTag DesiredTag = bShouldBeVisible
-		? StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Active
-		: StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Deactivated;
-
-	const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
-	if (!SlotData || !SlotData->IsValid())
+	FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+	if (!SlotData)
 	{
-		AcquireEntryWidget(GlobalIndex);
-		SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
+		return false;
 	}
 
-	if (!SlotData)
+	const UObject* Item = Items.IsValidIndex(SlotData->DataIndex) ? Items[SlotData->DataIndex].Get() : nullptr;
+	if (!bForceReassign && Item == SlotData->LastAssignedItem.Get())
 	{
-		UE_LOG(LogStrategyUI, Warning, TEXT("Failed to acquire slot data for index %d"), GlobalIndex);
-		return;
+		return false;
 	}
 
-	if (SlotData->TagState.HasTag(DesiredTag))
+	// An item may want a different entry class than the one it's shown with, re-acquire it if so
+	const FSoftObjectPath DesiredClassPath = ResolveEntryWidgetClass(GlobalIndex).ToSoftObjectPath();
+	if (PendingRequests.ContainsGlobalIndex(GlobalIndex) || SlotData->bConstructionDeferred || (!SlotData->bIsPlaceholder && SlotData->Widget.IsValid()
+		&& DesiredClassPath != FSoftObjectPath(SlotData->Widget->GetClass())))
 	{
-		return; // Already in correct state
+		ReleaseEntryWidget(GlobalIndex);
+		return true;
 	}
 
-	UpdateEntryLifecycleTagState(GlobalIndex, DesiredTag);
+	// Force BP_OnStrategyEntryItemAssigned, even if the slot still points at the same object
+	SlotData->ItemAssignedWidget.Reset();
+	return false;
 }
 
-void UBaseStrategyWidget::UpdateEntryLifecycleTagState(const int32 GlobalIndex, const FGameplayTag& NewStateTag)
+void UBaseStrategyWidget::OnDataProviderPageLoaded(const int32 PageIndex, const TArray<UObject*>& PageItems)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	// Validate that NewStateTag is child of EntryLifecycle.*
-	const FGameplayTag& EntryLifecycleParent = StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Parent;
-	if (!NewStateTag.MatchesTag(EntryLifecycleParent))
+	if (!IsUsingPagedDataProvider() || !PendingItemPages.Contains(PageIndex))
 	{
-		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryLifecycle tag: %s"), *NewStateTag.ToString());
-		return;
+		return; // Released (or never requested) since
 	}
 
-	FGameplayTagContainer& TagContainer = GlobalIndexToSlotData.FindOrAdd(GlobalIndex).TagState;
-	if (TagContainer.HasTag(NewStateTag))
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Page %d arrived with %d items"), __FUNCTION__, PageIndex, PageItems.Num());
+	StoreItemPage(PageIndex, PageItems);
+	if (bIsHibernating)
 	{
-		return; // No change
+		return; // Waking up updates the widgets anyway
 	}
 
-	const FGameplayTagContainer OldTags = TagContainer;
+	// Entries showing the page's unfetched items pick up the real ones
+	UpdateWidgets();
+}
 
-	// Remove other EntryLifecycle tags
-	TArray<FGameplayTag> TagsToRemove;
-	for (const FGameplayTag& ExistingTag : TagContainer)
-	{
-		if (ExistingTag.MatchesTag(EntryLifecycleParent))
-		{
-			TagsToRemove.Add(ExistingTag);
-		}
-	}
-	for (const FGameplayTag& TagToRemove : TagsToRemove)
-	{
-		TagContainer.RemoveTag(TagToRemove);
-	}
+void UBaseStrategyWidget::RefreshFromPagedProvider()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	// Add the new one
-	TagContainer.AddTag(NewStateTag);
+	ReleaseAllItemPages(/*bNotifyProvider=*/ true);
+	ItemPageSize = FMath::Max(1, IStrategyPagedDataProvider::Execute_GetItemPageSize(DataProvider));
 
-	if (TagContainer == OldTags)
-	{
-		return; // No net change
-	}
+	// Only the count is known up front, UpdateWidgets fetches the pages the window lands on
+	TArray<UObject*> UnfetchedItems;
+	UnfetchedItems.SetNumZeroed(IStrategyDataProvider::Execute_GetDataItemCount(DataProvider));
+	UE_LOG(
+		LogStrategyUI,
+		Verbose,
+		TEXT("%hs: Paged provider reports %d items in pages of %d"),
+		__FUNCTION__,
+		UnfetchedItems.Num(),
+		ItemPageSize
+	);
 
-	// Notify the widget
-	if (UUserWidget* Widget = AcquireEntryWidget(GlobalIndex))
-	{
-		NotifyStrategyEntryStateChange(GlobalIndex, Widget, OldTags, TagContainer);
-	}
+	SetItems(UnfetchedItems);
 }
 
-void UBaseStrategyWidget::UpdateEntryInteractionTagState(const int32 GlobalIndex, const FGameplayTag& InteractionTag, bool bEnable)
+void UBaseStrategyWidget::RequestItemPagesForWindow()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	const FGameplayTag& EntryInteractionParent = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Parent;
-	if (!InteractionTag.MatchesTag(EntryInteractionParent))
+	if (!IsValid(DataProvider))
 	{
-		UE_LOG(LogStrategyUI, Warning, TEXT("Invalid EntryInteraction tag: %s"), *InteractionTag.ToString());
 		return;
 	}
 
-	FGameplayTagContainer& TagContainer = GlobalIndexToSlotData.FindOrAdd(GlobalIndex).TagState;
-	const FGameplayTagContainer OldTags = TagContainer;
-
-	if (bEnable)
+	// Pages the window maps to; consecutive global indices mostly share one
+	TArray<int32, TInlineAllocator<8>> WindowPages;
+	int32 LastPageIndex = INDEX_NONE;
+	for (const int32 GlobalIndex : CurrentDesiredGlobalIndices)
 	{
-		TagContainer.AddTag(InteractionTag);
+		const int32 DataIndex = GetLayoutStrategyChecked().GlobalIndexToDataIndex(GlobalIndex);
+		if (DataIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 PageIndex = DataIndex / ItemPageSize;
+		if (PageIndex != LastPageIndex)
+		{
+			WindowPages.AddUnique(PageIndex);
+			LastPageIndex = PageIndex;
+		}
 	}
-	else
+
+	for (const int32 PageIndex : WindowPages)
 	{
-		TagContainer.RemoveTag(InteractionTag);
+		RequestItemPage(PageIndex);
 	}
 
-	if (UUserWidget* Widget = AcquireEntryWidget(GlobalIndex))
+	// Fetches the window left behind aren't worth finishing
+	TArray<int32, TInlineAllocator<8>> AbandonedPages;
+	for (const int32 PageIndex : PendingItemPages)
 	{
-		NotifyStrategyEntryStateChange(GlobalIndex, Widget, OldTags, TagContainer);
-
-		if (Widget->Implements<UStrategyEntryBase>())
+		if (!WindowPages.Contains(PageIndex))
 		{
-			// Optional: call focus/selection change callbacks
-			const FGameplayTag& FocusedTag  = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Focused;
-			const FGameplayTag& SelectedTag = StrategyUIGameplayTags::StrategyUI::EntryInteraction::Selected;
-
-			if (InteractionTag == FocusedTag)
-			{
-				IStrategyEntryBase::Execute_BP_OnItemFocusChanged(Widget, bEnable);
-			}
-			else if (InteractionTag == SelectedTag)
-			{
-				IStrategyEntryBase::Execute_BP_OnItemSelectionChanged(Widget, bEnable);
-			}
+			AbandonedPages.Add(PageIndex);
 		}
 	}
-}
-
-void UBaseStrategyWidget::UpdateWidgets()
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	if (GetItemCount() == 0)
+	// Release the least recently used pages past the budget, never the ones the window needs
+	const int32 MaxPages = FMath::Max(MaxResidentItemPages, WindowPages.Num());
+	int32 NumResidentPages = ResidentItemPages.Num();
+	for (int32 Idx = 0; Idx < ResidentItemPages.Num() && NumResidentPages > MaxPages; ++Idx)
 	{
-		UE_LOG(LogStrategyUI, Warning, TEXT("%hs called with no items to display!"), __FUNCTION__);
-		return;
+		if (!WindowPages.Contains(ResidentItemPages[Idx]))
+		{
+			AbandonedPages.Add(ResidentItemPages[Idx]);
+			--NumResidentPages;
+		}
 	}
 
-	if (!StrategyCanvasPanel.IsValid())
+	for (const int32 PageIndex : AbandonedPages)
 	{
-		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No StrategyCanvasPanel found!"), __FUNCTION__);
-		return;
+		ReleaseItemPage(PageIndex);
 	}
+}
 
-	if (!LayoutStrategy)
+bool UBaseStrategyWidget::RequestItemPage(const int32 PageIndex)
+{
+	const int32 ResidentIndex = ResidentItemPages.Find(PageIndex);
+	if (ResidentIndex != INDEX_NONE)
 	{
-		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No LayoutStrategy found!"), __FUNCTION__);
-		return;
+		// Most recently used goes last
+		if (ResidentIndex != ResidentItemPages.Num() - 1)
+		{
+			ResidentItemPages.RemoveAt(ResidentIndex, 1, EAllowShrinking::No);
+			ResidentItemPages.Add(PageIndex);
+		}
+		return true;
 	}
 
-	// Gather desired indices from the layout
-	TSet<int32> NewDesiredIndices = GetLayoutStrategyChecked().ComputeDesiredGlobalIndices();
-	
-	// (1) Release old widgets not in the new set
-	ReleaseUndesiredWidgets(NewDesiredIndices);
+	if (PendingItemPages.Contains(PageIndex))
+	{
+		return false;
+	}
 
-	// (2) Possibly handle transitions out of "pooled" (like TryHandlePooledEntryStateTransition)
-	for (const int32 Idx : NewDesiredIndices)
+	TArray<UObject*> PageItems;
+	if (IStrategyPagedDataProvider::Execute_FetchItemPage(DataProvider, PageIndex, PageItems))
 	{
-		TryHandlePooledEntryStateTransition(Idx);
-		UpdateEntryWidget(Idx);
+		StoreItemPage(PageIndex, PageItems);
+		return true;
 	}
 
-	// (3) Rebuild the panel, forcing each widget to re-acquire or update
-	RebuildSlateForIndices(NewDesiredIndices, /*bForceUpdateWidget=*/true);
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Waiting on page %d"), __FUNCTION__, PageIndex);
+	PendingItemPages.Add(PageIndex);
+	return false;
 }
 
-bool UBaseStrategyWidget::HasNewDesiredIndices(const TSet<int32>& NewIndices) const
+void UBaseStrategyWidget::StoreItemPage(const int32 PageIndex, const TArray<UObject*>& PageItems)
 {
-	const bool bAreSetsIdentical = (LastDesiredIndices.Num() == NewIndices.Num()
-	   && LastDesiredIndices.Includes(NewIndices)
-	   && NewIndices.Includes(LastDesiredIndices)
-	   && LastDesiredIndices.Num() > 0
-	   && NewIndices.Num() > 0);
-	return !bAreSetsIdentical;
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-void UBaseStrategyWidget::RebuildSlateForIndices(const TSet<int32>& InIndices, const bool bForceUpdateWidget)
-{
-	if (!StrategyCanvasPanel.IsValid())
-	{
-		UE_LOG(LogStrategyUI, Error, TEXT("%hs: No StrategyCanvasPanel found!"), __FUNCTION__);
-		return;
-	}
+	PendingItemPages.Remove(PageIndex);
+	ResidentItemPages.Remove(PageIndex);
+	ResidentItemPages.Add(PageIndex);
 
-	// Create a temporary map to hold minimal slot data for the Slate panel.
-	// (This is our “minimal” data that our improved SStrategyCanvasPanel expects.)
-	TMap<int32, FStrategyCanvasSlotData_Minimal> MinimalSlotDataMap;
-	MinimalSlotDataMap.Reserve(InIndices.Num());
+	const int32 StartIndex = PageIndex * ItemPageSize;
+	const int32 NumPageItems = FMath::Min3(ItemPageSize, PageItems.Num(), GetItemCount() - StartIndex);
+	UE_CLOG(
+		PageItems.Num() != NumPageItems,
+		LogStrategyUI,
+		Warning,
+		TEXT("%hs: Page %d has %d items, expected %d"),
+		__FUNCTION__,
+		PageIndex,
+		PageItems.Num(),
+		NumPageItems
+	);
 
-	// Iterate once over all global indices that should be shown.
-	for (int32 GlobalIndex : InIndices)
+	TArray<int32, TInlineAllocator<16>> StaleGlobalIndices;
+	for (int32 Offset = 0; Offset < NumPageItems; ++Offset)
 	{
-		// Optionally force an update/re-acquisition of the entry widget.
-		if (bForceUpdateWidget)
-		{
-			UpdateEntryWidget(GlobalIndex);
-		}
-
-		// Compute the final position for this entry
-		const FVector2D ItemLocalPos = GetLayoutStrategyChecked().GetItemPosition(GlobalIndex);
-		// For now, we use a fixed depth. @TODO: Implement depth handling in the layout strategy.
-		constexpr float DepthValue = 0.f;
-
-		// Find the slot data for this global index.
-		FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
-		if (!SlotData)
-		{
-			// If none exists, try to acquire the widget and then retrieve the slot data.
-			AcquireEntryWidget(GlobalIndex);
-			SlotData = GlobalIndexToSlotData.Find(GlobalIndex);
-			if (!SlotData)
-			{
-				UE_LOG(LogStrategyUI, Warning, TEXT("Could not create slot for index %d"), GlobalIndex);
-				continue;
-			}
-		}
-
-		// Update the slot data with the computed position and depth.
-		UE_LOG(
-			LogStrategyUI,
-			VeryVerbose,
-			TEXT("%hs: Updating slot data for global index %d at position %s"),
-			__FUNCTION__,
-			GlobalIndex,
-			*ItemLocalPos.ToString()
-		);
-		SlotData->Position = ItemLocalPos;
-		SlotData->Depth = DepthValue;
+		const int32 DataIndex = StartIndex + Offset;
+		Items[DataIndex] = PageItems[Offset];
 
-		// Now convert our full slot data into minimal data required by the Slate panel.
-		if (SlotData->IsValid())
+		for (auto It = DataIndexToGlobalIndices.CreateConstKeyIterator(DataIndex); It; ++It)
 		{
-			const TSharedPtr<SWidget> UnderlyingSlateWidget = SlotData->CachedSlateWidget;
-			if (!UnderlyingSlateWidget.IsValid())
-			{
-				UE_LOG(LogStrategyUI, Warning, TEXT("No cached Slate widget for global index %d"), GlobalIndex);
-				continue;
-			}
-
-			FStrategyCanvasSlotData_Minimal MinimalData;
-			MinimalData.Position = SlotData->Position;
-			MinimalData.Depth = SlotData->Depth;
-			MinimalData.Widget = UnderlyingSlateWidget.ToSharedRef();
-			UE_LOG(
-				LogStrategyUI,
-				VeryVerbose,
-				TEXT("%hs: Adding minimal data for global index %d at position %s"),
-				__FUNCTION__,
-				GlobalIndex,
-				*ItemLocalPos.ToString()
-			);
-			MinimalSlotDataMap.Add(GlobalIndex, MinimalData);
+			StaleGlobalIndices.Add(It.Value());
 		}
 	}
 
-	// Do one single update call to the Slate panel, passing in the minimal data map.
-	StrategyCanvasPanel->UpdateChildrenData(MinimalSlotDataMap);
+	// Entries acquired before their item arrived were given the default entry class
+	for (const int32 GlobalIndex : StaleGlobalIndices)
+	{
+		RefreshEntryItem(GlobalIndex, /*bForceReassign=*/ false);
+	}
 }
-#pragma endregion EntryWidgetsPoolAndHandling
 
-#pragma region UBaseStrategyWidget - Internal Implementations
-void UBaseStrategyWidget::SetItems_Internal_Implementation(const TArray<UObject*>& InItems)
+void UBaseStrategyWidget::ReleaseItemPage(const int32 PageIndex)
 {
-	Items = InItems;
-	if (GetItemCount() <= 0)
+	const bool bWasResident = ResidentItemPages.Remove(PageIndex) > 0;
+	const bool bWasPending = PendingItemPages.Remove(PageIndex) > 0;
+	if (!bWasResident && !bWasPending)
 	{
-		UE_LOG(LogStrategyUI, Log, TEXT("%hs called with no items to display!"), __FUNCTION__);
 		return;
 	}
 
-	UE_LOG(
-		LogStrategyUI,
-		Verbose,
-		TEXT("%hs: Initializing %s as strategy host for %d items"),
-		__FUNCTION__,
-		*GetName(),
-		GetItemCount()
-	);
+	if (bWasResident)
+	{
+		const int32 StartIndex = PageIndex * ItemPageSize;
+		const int32 EndIndex = FMath::Min(StartIndex + ItemPageSize, GetItemCount());
+		for (int32 DataIndex = StartIndex; DataIndex < EndIndex; ++DataIndex)
+		{
+			ResolvedEntryClassCache.Remove(Items[DataIndex].Get());
+			Items[DataIndex] = nullptr;
+		}
+	}
 
-	GetLayoutStrategyChecked().InitializeStrategy(this);
-	UpdateWidgets();
+	if (IsValid(DataProvider) && DataProvider->Implements<UStrategyPagedDataProvider>())
+	{
+		IStrategyPagedDataProvider::Execute_ReleaseItemPage(DataProvider, PageIndex);
+	}
 }
-#pragma endregion
 
-#pragma region UBaseStrategyWidget - Data Provider
-void UBaseStrategyWidget::OnDataProviderUpdated()
+void UBaseStrategyWidget::ReleaseAllItemPages(const bool bNotifyProvider)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Data provider updated"), __FUNCTION__);
+	if (bNotifyProvider)
+	{
+		TArray<int32, TInlineAllocator<16>> PagesToRelease(ResidentItemPages);
+		PagesToRelease.Append(PendingItemPages.Array());
+		for (const int32 PageIndex : PagesToRelease)
+		{
+			ReleaseItemPage(PageIndex);
+		}
+	}
 
-	RefreshFromProvider();
+	ResidentItemPages.Reset();
+	PendingItemPages.Reset();
 }
 
 void UBaseStrategyWidget::RefreshFromProvider()
@@ -1178,6 +3141,12 @@ void UBaseStrategyWidget::RefreshFromProvider()
 
 	if (IS_DATA_PROVIDER_READY_AND_VALID(DataProvider))
 	{
+		if (DataProvider->Implements<UStrategyPagedDataProvider>())
+		{
+			RefreshFromPagedProvider();
+			return;
+		}
+
 		const TArray<UObject*> ProvidedItems = IStrategyDataProvider::Execute_GetDataItems(DataProvider);
 		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Received %d items from provider"), __FUNCTION__, ProvidedItems.Num());
 
@@ -1234,4 +3203,70 @@ void UBaseStrategyWidget::UpdateReflectedObjectsDebugCategory()
 }
 
 #endif // WITH_GAMEPLAY_DEBUGGER
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+#pragma region UBaseStrategyWidget - Stats
+FStrategyWidgetFrameStats& UBaseStrategyWidget::GetCurrentFrameStats()
+{
+	if (FrameStats.FrameNumber != static_cast<int64>(GFrameCounter))
+	{
+		// Slots outlive the frame, everything else counts from zero again
+		const int32 NumLiveSlots = FrameStats.NumLiveSlots;
+		FrameStats = FStrategyWidgetFrameStats();
+		FrameStats.FrameNumber = static_cast<int64>(GFrameCounter);
+		FrameStats.NumLiveSlots = NumLiveSlots;
+	}
+	return FrameStats;
+}
+
+void UBaseStrategyWidget::RecordEntryAcquired(const bool bPoolHit)
+{
+	FStrategyWidgetFrameStats& Stats = GetCurrentFrameStats();
+	++Stats.NumAcquires;
+	INC_DWORD_STAT(STAT_StrategyUI_EntryAcquires);
+	if (bPoolHit)
+	{
+		++Stats.NumPoolHits;
+		INC_DWORD_STAT(STAT_StrategyUI_EntryPoolHits);
+	}
+}
+
+void UBaseStrategyWidget::RecordEntryReleased()
+{
+	++GetCurrentFrameStats().NumReleases;
+	INC_DWORD_STAT(STAT_StrategyUI_EntryReleases);
+}
+
+void UBaseStrategyWidget::RecordBlueprintDispatch()
+{
+	++GetCurrentFrameStats().NumBlueprintDispatches;
+	INC_DWORD_STAT(STAT_StrategyUI_BlueprintDispatches);
+}
+
+void UBaseStrategyWidget::RecordAsyncLoadCompleted(const double RequestTime)
+{
+	const float LatencyMs = RequestTime > 0.0 ? static_cast<float>((FPlatformTime::Seconds() - RequestTime) * 1000.0) : 0.f;
+
+	FStrategyWidgetFrameStats& Stats = GetCurrentFrameStats();
+	++Stats.NumAsyncLoadsCompleted;
+	Stats.MaxAsyncLoadLatencyMs = FMath::Max(Stats.MaxAsyncLoadLatencyMs, LatencyMs);
+	INC_DWORD_STAT(STAT_StrategyUI_AsyncLoadsCompleted);
+	INC_FLOAT_STAT_BY(STAT_StrategyUI_AsyncLoadLatency, LatencyMs);
+
+	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("%s - %hs: Async load completed after %.2f ms"), *GetName(), __FUNCTION__, LatencyMs);
+}
+
+void UBaseStrategyWidget::RecordLiveSlots()
+{
+	const int32 NumLiveSlots = GlobalIndexToSlotData.Num();
+	GetCurrentFrameStats().NumLiveSlots = NumLiveSlots;
+	if (NumLiveSlots > ReportedLiveSlots)
+	{
+		INC_DWORD_STAT_BY(STAT_StrategyUI_LiveSlots, NumLiveSlots - ReportedLiveSlots);
+	}
+	else if (NumLiveSlots < ReportedLiveSlots)
+	{
+		DEC_DWORD_STAT_BY(STAT_StrategyUI_LiveSlots, ReportedLiveSlots - NumLiveSlots);
+	}
+	ReportedLiveSlots = NumLiveSlots;
+}
+#pragma endregion
@@ -1,7 +1,10 @@
 ﻿#include "Widgets/SStrategyCanvasPanel.h"
 
 #include "Utils/LogStrategyUI.h"
+#include "Utils/StrategyUIStats.h"
 #include "Widgets/SNullWidget.h"
+#include <Fonts/FontMeasure.h>
+#include <Framework/Application/SlateApplication.h>
 
 SStrategyCanvasPanel::SStrategyCanvasPanel()
 	: SPanel(), Children(this), CombinedChildren(this)
@@ -21,154 +24,299 @@ void SStrategyCanvasPanel::Construct(const FArguments& InArgs)
 
 void SStrategyCanvasPanel::UpdateChildrenData(const TMap<int32, FStrategyCanvasSlotData_Minimal>& InSlotData)
 {
-	// --- Step 1: Identify slots to remove and gather index updates ---
-	TArray<int32> SlotsToRemove;
-	TArray<TTuple<int32, int32>> GlobalIndices; // Stores {GlobalIndex, SlotIndex} pairs -- SlotIndex refers to the TPanelChildren index
-	
-	// First pass: Identify removals and build current index mapping
-	for (const auto& Pair : GlobalIndexToSlot)
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_UpdateChildrenData);
+
+	// --- Step 1: Remove children that are no longer present ---
+	for (auto It = GlobalIndexToSlot.CreateIterator(); It; ++It)
+	{
+		if (!InSlotData.Contains(It.Key()))
+		{
+			RemoveChildSlot(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	// --- Step 2: Patch existing children, add new ones ---
+	for (const TPair<int32, FStrategyCanvasSlotData_Minimal>& Pair : InSlotData)
 	{
-		if (!InSlotData.Contains(Pair.Key))
+		const int32 GlobalIndex = Pair.Key;
+		const FStrategyCanvasSlotData_Minimal& NewData = Pair.Value;
+		if (!NewData.Widget.IsValid())
+		{
+			continue;
+		}
+
+		FStrategyCanvasSlotHandle& Handle = GlobalIndexToSlot.FindOrAdd(GlobalIndex);
+		if (IsValidChildSlot(Handle))
 		{
-			SlotsToRemove.Add(Pair.Value);
+			SetChildSlotWidget(Handle, NewData.Widget.ToSharedRef());
+			SetChildSlotPosition(Handle, NewData.Position, NewData.Depth);
 		}
 		else
 		{
-			GlobalIndices.Add(MakeTuple(Pair.Key, Pair.Value));
+			Handle = AddChildSlot(NewData);
+			UE_LOG(LogStrategyUI, VeryVerbose, TEXT("Added new slot %d for global index %d"), Handle.SlotIndex, GlobalIndex);
 		}
 	}
+}
+
+FStrategyCanvasSlotHandle SStrategyCanvasPanel::AddChildSlot(const FStrategyCanvasSlotData_Minimal& InSlotData)
+{
+	if (!ensure(InSlotData.Widget.IsValid()))
+	{
+		return FStrategyCanvasSlotHandle();
+	}
 
-	// Sort slots to remove in descending order to maintain validity
-	SlotsToRemove.Sort([](const int32& A, const int32& B) { return A > B; });
+	int32 SlotIndex = INDEX_NONE;
+	if (!FreeSlotIndices.IsEmpty())
+	{
+		SlotIndex = FreeSlotIndices.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = Children.AddSlot(MakeUnique<FStrategyCanvasChildSlot_Internal>());
+	}
+
+	FStrategyCanvasChildSlot_Internal& Slot = Children[SlotIndex];
+	Slot.Position = InSlotData.Position;
+	Slot.Depth = InSlotData.Depth;
+	Slot.Widget = InSlotData.Widget;
+	Slot.bInUse = true;
+	Slot.bNeedsPrepass = true;
+	Slot[InSlotData.Widget.ToSharedRef()];
+	bSortedSlotsDirty = true;
+
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+
+	FStrategyCanvasSlotHandle Handle;
+	Handle.SlotIndex = SlotIndex;
+	Handle.Generation = Slot.Generation;
+	return Handle;
+}
+
+void SStrategyCanvasPanel::RemoveChildSlot(const FStrategyCanvasSlotHandle& Handle)
+{
+	FStrategyCanvasChildSlot_Internal* Slot = FindChildSlot(Handle);
+	if (!Slot)
+	{
+		return;
+	}
+
+	Slot->Widget.Reset();
+	Slot->bInUse = false;
+	++Slot->Generation;
+	(*Slot)[SNullWidget::NullWidget];
+	FreeSlotIndices.Add(Handle.SlotIndex);
+	bSortedSlotsDirty = true;
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("Removed child at slot index %d"), Handle.SlotIndex);
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+void SStrategyCanvasPanel::SetChildSlotPosition(const FStrategyCanvasSlotHandle& Handle, const FVector2D& InPosition, const float InDepth)
+{
+	FStrategyCanvasChildSlot_Internal* Slot = FindChildSlot(Handle);
+	if (!Slot || (Slot->Position == InPosition && Slot->Depth == InDepth))
+	{
+		return;
+	}
+
+	if (Slot->Depth != InDepth)
+	{
+		bSortedSlotsDirty = true;
+	}
+	Slot->Position = InPosition;
+	Slot->Depth = InDepth;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SStrategyCanvasPanel::SetChildSlotWidget(const FStrategyCanvasSlotHandle& Handle, const TSharedRef<SWidget>& InWidget)
+{
+	FStrategyCanvasChildSlot_Internal* Slot = FindChildSlot(Handle);
+	if (!Slot || Slot->Widget == InWidget)
+	{
+		return;
+	}
+
+	Slot->Widget = InWidget;
+	Slot->bNeedsPrepass = true;
+	(*Slot)[InWidget];
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+bool SStrategyCanvasPanel::IsValidChildSlot(const FStrategyCanvasSlotHandle& Handle) const
+{
+	return Handle.IsSet()
+		&& Children.IsValidIndex(Handle.SlotIndex)
+		&& Children[Handle.SlotIndex].bInUse
+		&& Children[Handle.SlotIndex].Generation == Handle.Generation;
+}
 
-	// --- Step 2: Remove slots from highest index to lowest ---
-	for (const int32 SlotIndex : SlotsToRemove)
+void SStrategyCanvasPanel::ClearChildSlots()
+{
+	// Bump generations rather than dropping slots, so handles held elsewhere can't match a future slot
+	FreeSlotIndices.Reset(Children.Num());
+	for (int32 SlotIndex = Children.Num() - 1; SlotIndex >= 0; --SlotIndex)
 	{
-		if (Children.IsValidIndex(SlotIndex))
+		FStrategyCanvasChildSlot_Internal& Slot = Children[SlotIndex];
+		if (Slot.bInUse)
 		{
-			Children.RemoveAt(SlotIndex);
-			UE_LOG(LogStrategyUI, Verbose, TEXT("Removed child at slot index %d"), SlotIndex);
+			Slot.Widget.Reset();
+			Slot.bInUse = false;
+			++Slot.Generation;
+			Slot[SNullWidget::NullWidget];
 		}
+		FreeSlotIndices.Add(SlotIndex);
 	}
+	GlobalIndexToSlot.Reset();
+	SortedSlotIndices.Reset();
+	bSortedSlotsDirty = false;
 
-	// --- Step 3: Rebuild GlobalIndexToSlot mapping ---
-	GlobalIndexToSlot.Empty();
-	
-	// Sort remaining indices by slot index to maintain order
-	GlobalIndices.Sort([](const TTuple<int32, int32>& A, const TTuple<int32, int32>& B) {
-		return A.Get<1>() < B.Get<1>();
-	});
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+void SStrategyCanvasPanel::SetProxyEntries(const TConstArrayView<FStrategyCanvasProxyEntry> InProxyEntries)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
-	// Rebuild mapping with updated indices
-	int32 NewSlotIndex = 0;
-	for (const auto& Tuple : GlobalIndices)
+	if (InProxyEntries.IsEmpty() && ProxyEntries.IsEmpty())
 	{
-		const int32 GlobalIndex = Tuple.Get<0>();
-		GlobalIndexToSlot.Add(GlobalIndex, NewSlotIndex++);
+		return;
 	}
 
-	// --- Step 4: Update or add new slots ---
-	for (const auto& Pair : InSlotData)
+	// Reuses our allocation frame to frame
+	ProxyEntries.Reset(InProxyEntries.Num());
+	ProxyEntries.Append(InProxyEntries.GetData(), InProxyEntries.Num());
+	ProxyEntries.StableSort([](const FStrategyCanvasProxyEntry& A, const FStrategyCanvasProxyEntry& B)
 	{
-		const int32 GlobalIndex = Pair.Key;
-		const FStrategyCanvasSlotData_Minimal& NewData = Pair.Value;
+		return A.Depth < B.Depth;
+	});
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+int32 SStrategyCanvasPanel::PaintProxyEntries(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FWidgetStyle& InWidgetStyle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (ProxyEntries.IsEmpty())
+	{
+		return LayerId;
+	}
+
+	const FVector2D PanelCenter = AllottedGeometry.GetLocalSize() * 0.5f;
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	bool bDrewLabel = false;
 
-		if (int32* ExistingSlotIndex = GlobalIndexToSlot.Find(GlobalIndex))
+	for (const FStrategyCanvasProxyEntry& Proxy : ProxyEntries)
+	{
+		const FVector2D TopLeft = PanelCenter + Proxy.Position - (Proxy.Size * 0.5f);
+		if (Proxy.Brush)
 		{
-			// Update existing slot
-			if (Children.IsValidIndex(*ExistingSlotIndex))
-			{
-				FStrategyCanvasChildSlot_Internal& Slot = Children[*ExistingSlotIndex];
-				Slot.Position = NewData.Position;
-				Slot.Depth = NewData.Depth;
-				Slot.Widget = NewData.Widget;
-				Slot[NewData.Widget.ToSharedRef()];
-				
-				UE_LOG(LogStrategyUI, VeryVerbose, TEXT("Updated existing slot %d for global index %d"), 
-					*ExistingSlotIndex, GlobalIndex);
-			}
+			FSlateDrawElement::MakeBox(
+				OutDrawElements,
+				LayerId,
+				AllottedGeometry.ToPaintGeometry(Proxy.Size, FSlateLayoutTransform(TopLeft)),
+				Proxy.Brush,
+				ESlateDrawEffect::None,
+				Proxy.Brush->GetTint(InWidgetStyle) * Proxy.Tint
+			);
 		}
-		else
+
+		if (!Proxy.Label.IsEmpty())
 		{
-			// Add new slot
-			const int32 NewIndex = Children.AddSlot(MakeUnique<FStrategyCanvasChildSlot_Internal>());
-			FStrategyCanvasChildSlot_Internal& Slot = Children[NewIndex];
-			Slot.Position = NewData.Position;
-			Slot.Depth = NewData.Depth;
-			Slot.Widget = NewData.Widget;
-			Slot[NewData.Widget.ToSharedRef()];
-			
-			GlobalIndexToSlot.Add(GlobalIndex, NewIndex);
-			UE_LOG(LogStrategyUI, VeryVerbose, TEXT("Added new slot %d for global index %d"), 
-				NewIndex, GlobalIndex);
+			const FVector2D LabelSize = FontMeasure->Measure(Proxy.Label, ProxyFont);
+			const FVector2D LabelTopLeft = PanelCenter + Proxy.Position - (LabelSize * 0.5f);
+			FSlateDrawElement::MakeText(
+				OutDrawElements,
+				LayerId + 1,
+				AllottedGeometry.ToPaintGeometry(LabelSize, FSlateLayoutTransform(LabelTopLeft)),
+				Proxy.Label,
+				ProxyFont,
+				ESlateDrawEffect::None,
+				InWidgetStyle.GetColorAndOpacityTint()
+			);
+			bDrewLabel = true;
 		}
 	}
 
-	Invalidate(EInvalidateWidget::LayoutAndVolatility);
+	return bDrewLabel ? LayerId + 2 : LayerId + 1;
 }
 
+SStrategyCanvasPanel::FStrategyCanvasChildSlot_Internal* SStrategyCanvasPanel::FindChildSlot(const FStrategyCanvasSlotHandle& Handle)
+{
+	return IsValidChildSlot(Handle) ? &Children[Handle.SlotIndex] : nullptr;
+}
 
-void SStrategyCanvasPanel::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+void SStrategyCanvasPanel::UpdateSortedSlotIndices() const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	
-	TSet<TWeakPtr<SWidget>> ArrangedWidgets;
-	
-	struct FSortSlot
+	if (!bSortedSlotsDirty)
 	{
-		int32 SlotIndex;
-		float Depth;
-	};
+		return;
+	}
 
-	TArray<FSortSlot> Sorted;
-	Sorted.Empty(Children.Num());
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
+	SortedSlotIndices.Reset(Children.Num());
 	for (int32 i = 0; i < Children.Num(); i++)
 	{
-		const FStrategyCanvasChildSlot_Internal& Slot = Children[i];
-		if (Slot.Widget.IsValid())
+		if (Children[i].bInUse)
 		{
-			Sorted.Add({ i, Slot.Depth });
+			SortedSlotIndices.Add(i);
 		}
 	}
 
-	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("%hs: Sorting %d slots by depth"), __FUNCTION__, Sorted.Num());
-	Sorted.Sort([](const FSortSlot& A, const FSortSlot& B)
+	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("%hs: Sorting %d slots by depth"), __FUNCTION__, SortedSlotIndices.Num());
+	SortedSlotIndices.Sort([this](const int32 A, const int32 B)
 	{
-		return A.Depth < B.Depth;
+		// Tie-break on slot index so equal depths keep a stable paint order
+		const float DepthA = Children[A].Depth;
+		const float DepthB = Children[B].Depth;
+		return DepthA < DepthB || (DepthA == DepthB && A < B);
 	});
 
+	bSortedSlotsDirty = false;
+}
+
+void SStrategyCanvasPanel::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_CanvasArrangeChildren);
+
+	UpdateSortedSlotIndices();
+
+	const FVector2D PanelCenter = AllottedGeometry.GetLocalSize() * 0.5f;
+
 	// Add each valid slot to ArrangedChildren
-	for (const FSortSlot& Entry : Sorted)
+	for (const int32 SlotIndex : SortedSlotIndices)
 	{
-		const FStrategyCanvasChildSlot_Internal& Slot = Children[Entry.SlotIndex];
-		const TWeakPtr<SWidget> ChildWidget = Slot.Widget;
-
-		if (!ChildWidget.IsValid() || ArrangedWidgets.Contains(ChildWidget))
+		const FStrategyCanvasChildSlot_Internal& Slot = Children[SlotIndex];
+		const TSharedPtr<SWidget> ChildWidget = Slot.Widget.Pin();
+		if (!ChildWidget.IsValid())
 		{
-			UE_LOG(LogStrategyUI, Warning, TEXT("%hs: Slot %d has an invalid widget!"), __FUNCTION__, Entry.SlotIndex);
+			UE_LOG(LogStrategyUI, Warning, TEXT("%hs: Slot %d has an invalid widget!"), __FUNCTION__, SlotIndex);
 			continue;
 		}
 
-		const TSharedRef<SWidget> ChildWidgetRef = ChildWidget.Pin().ToSharedRef();
-
-		ChildWidgetRef->SlatePrepass();
+		// Children that were just added haven't been prepassed by Slate yet, everyone else already has an up-to-date desired size
+		if (Slot.bNeedsPrepass)
+		{
+			ChildWidget->SlatePrepass();
+			Slot.bNeedsPrepass = false;
+		}
 
-		const FVector2D EntryDesiredSize = ChildWidgetRef->GetDesiredSize();
-		const FVector2D PanelCenter = AllottedGeometry.GetLocalSize() * 0.5f;
+		const FVector2D EntryDesiredSize = ChildWidget->GetDesiredSize();
 		const FVector2D FinalPos = PanelCenter + Slot.Position - (EntryDesiredSize * 0.5f);
-		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Arranging widget %s at LocalPos %s (center: %s -- FinalPos: %s) with size %s"),__FUNCTION__, *UStrategyUIFunctionLibrary::GetFriendlySlateWidgetName(ChildWidget), *Slot.Position.ToString(), *PanelCenter.ToString(), *FinalPos.ToString(), *EntryDesiredSize.ToString());
+		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Arranging widget %s at LocalPos %s (center: %s -- FinalPos: %s) with size %s"),__FUNCTION__, *UStrategyUIFunctionLibrary::GetFriendlySlateWidgetName(Slot.Widget), *Slot.Position.ToString(), *PanelCenter.ToString(), *FinalPos.ToString(), *EntryDesiredSize.ToString());
 
 		ArrangedChildren.AddWidget(
 			AllottedGeometry.MakeChild(
-				ChildWidgetRef,
+				ChildWidget.ToSharedRef(),
 				FinalPos,
 				EntryDesiredSize
 			)
 		);
-
-		// Don't re-arrange this widget
-		ArrangedWidgets.Add(ChildWidget);
 	}
 }
 
@@ -192,10 +340,15 @@ int32 SStrategyCanvasPanel::OnPaint(
 	const FWidgetStyle& InWidgetStyle,
 	bool bParentEnabled) const
 {
-	FArrangedChildren Arranged(EVisibility::Visible);
+	STRATEGYUI_TRACE_SCOPE(__FUNCTION__);
+	SCOPE_CYCLE_COUNTER(STAT_StrategyUI_CanvasPaint);
+
+	FArrangedChildren& Arranged = PaintArrangedChildren;
+	Arranged.GetInternalArray().Reset();
 	this->ArrangeChildren(AllottedGeometry, Arranged);
 
-	int32 MaxLayerId = LayerId;
+	// Proxies go underneath the real entries
+	int32 MaxLayerId = PaintProxyEntries(AllottedGeometry, OutDrawElements, LayerId, InWidgetStyle);
 	const bool bIsEnabled = ShouldBeEnabled(bParentEnabled);
 
 	// Paint each arranged child.
@@ -227,5 +380,7 @@ int32 SStrategyCanvasPanel::OnPaint(
 
 	}
 
+	// Drop the child references but keep the allocation
+	Arranged.GetInternalArray().Reset();
 	return MaxLayerId;
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Widgets/StrategyEntryWidgetBase.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyEntryWidgetBase)
+
+#pragma region UStrategyEntryWidgetBase - Native Hooks
+void UStrategyEntryWidgetBase::NativeOnStrategyEntryItemAssigned(const UObject* InItem)
+{
+	if (EnumHasAnyFlags(GetBlueprintEntryEvents(), EStrategyEntryEvents::ItemAssigned))
+	{
+		Execute_BP_OnStrategyEntryItemAssigned(this, InItem);
+	}
+}
+
+void UStrategyEntryWidgetBase::NativeOnStrategyEntryStateChanged(const EStrategyEntryState OldState, const EStrategyEntryState NewState)
+{
+	if (EnumHasAnyFlags(GetBlueprintEntryEvents(), EStrategyEntryEvents::StateTagsChanged))
+	{
+		Execute_BP_OnStrategyEntryStateTagsChanged(this, StrategyEntryState::ToTagContainer(OldState), StrategyEntryState::ToTagContainer(NewState));
+	}
+}
+
+void UStrategyEntryWidgetBase::NativeOnItemFocusChanged(const bool bIsFocused)
+{
+	if (EnumHasAnyFlags(GetBlueprintEntryEvents(), EStrategyEntryEvents::FocusChanged))
+	{
+		Execute_BP_OnItemFocusChanged(this, bIsFocused);
+	}
+}
+
+void UStrategyEntryWidgetBase::NativeOnItemSelectionChanged(const bool bIsSelected)
+{
+	if (EnumHasAnyFlags(GetBlueprintEntryEvents(), EStrategyEntryEvents::SelectionChanged))
+	{
+		Execute_BP_OnItemSelectionChanged(this, bIsSelected);
+	}
+}
+#pragma endregion
+
+EStrategyEntryEvents UStrategyEntryWidgetBase::GetBlueprintEntryEvents() const
+{
+	if (!bHasResolvedBlueprintEntryEvents)
+	{
+		const UClass* Class = GetClass();
+		auto AddIfImplemented = [this, Class](const FName FunctionName, const EStrategyEntryEvents Event)
+		{
+			if (Class->IsFunctionImplementedInScript(FunctionName))
+			{
+				BlueprintEntryEvents |= Event;
+			}
+		};
+		AddIfImplemented(GET_FUNCTION_NAME_CHECKED(IStrategyEntryBase, BP_OnStrategyEntryItemAssigned), EStrategyEntryEvents::ItemAssigned);
+		AddIfImplemented(GET_FUNCTION_NAME_CHECKED(IStrategyEntryBase, BP_OnStrategyEntryStateTagsChanged), EStrategyEntryEvents::StateTagsChanged);
+		AddIfImplemented(GET_FUNCTION_NAME_CHECKED(IStrategyEntryBase, BP_OnItemFocusChanged), EStrategyEntryEvents::FocusChanged);
+		AddIfImplemented(GET_FUNCTION_NAME_CHECKED(IStrategyEntryBase, BP_OnItemSelectionChanged), EStrategyEntryEvents::SelectionChanged);
+		bHasResolvedBlueprintEntryEvents = true;
+	}
+	return BlueprintEntryEvents;
+}
+
+EStrategyEntryDispatch UStrategyEntryWidgetBase::ResolveEntryDispatch(const UUserWidget* Widget)
+{
+	if (!Widget)
+	{
+		return EStrategyEntryDispatch::None;
+	}
+	if (Widget->IsA<UStrategyEntryWidgetBase>())
+	{
+		return EStrategyEntryDispatch::Native;
+	}
+	return Widget->Implements<UStrategyEntryBase>() ? EStrategyEntryDispatch::Interface : EStrategyEntryDispatch::None;
+}
@@ -20,4 +20,8 @@ class ILayoutStrategyHost : public IInterface
 public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|LayoutStrategyHost")
 	int32 GetNumItems() const;
+
+	/** Whether entries past the real-widget budget may be drawn as proxies, letting the desired window grow past MAX_ENTRY_COUNT. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|LayoutStrategyHost")
+	bool UsesEntryProxies() const;
 };
\ No newline at end of file
@@ -13,6 +13,82 @@
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDataProviderUpdated);
 
+/** The kind of edit a FStrategyDataProviderChange describes. */
+UENUM(BlueprintType)
+enum class EStrategyDataProviderChangeType : uint8
+{
+	/** Count items were inserted, the first now lives at StartIndex. */
+	Inserted,
+	/** Count items starting at StartIndex were removed. */
+	Removed,
+	/** Count items starting at StartIndex were moved, they now start at DestinationIndex (an index into the array after their removal). */
+	Moved,
+	/** Count items starting at StartIndex were replaced or had their contents modified in place. */
+	Changed
+};
+
+/** A single contiguous edit to a data provider's items. */
+USTRUCT(BlueprintType)
+struct STRATEGYUI_API FStrategyDataProviderChange
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StrategyUI|StrategyDataProvider")
+	EStrategyDataProviderChangeType Type = EStrategyDataProviderChangeType::Changed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StrategyUI|StrategyDataProvider", meta = (ClampMin = "0"))
+	int32 StartIndex = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StrategyUI|StrategyDataProvider", meta = (ClampMin = "1"))
+	int32 Count = 1;
+
+	/** Only used by Moved. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StrategyUI|StrategyDataProvider")
+	int32 DestinationIndex = INDEX_NONE;
+};
+
+/**
+ * An ordered batch of edits to a data provider's items.
+ *
+ * Changes are applied in order, each index refers to the item array as left by the changes before it.
+ * The provider must already have applied the edits to its own items when it broadcasts the delta.
+ */
+USTRUCT(BlueprintType)
+struct STRATEGYUI_API FStrategyDataProviderDelta
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StrategyUI|StrategyDataProvider")
+	TArray<FStrategyDataProviderChange> Changes;
+
+	void AddChange(const EStrategyDataProviderChangeType Type, const int32 StartIndex, const int32 Count = 1, const int32 DestinationIndex = INDEX_NONE)
+	{
+		FStrategyDataProviderChange& Change = Changes.AddDefaulted_GetRef();
+		Change.Type = Type;
+		Change.StartIndex = StartIndex;
+		Change.Count = Count;
+		Change.DestinationIndex = DestinationIndex;
+	}
+
+	/** Whether any change adds, removes or reorders items (as opposed to only modifying them). */
+	bool HasStructuralChanges() const
+	{
+		return Changes.ContainsByPredicate([](const FStrategyDataProviderChange& Change)
+		{
+			return Change.Type != EStrategyDataProviderChangeType::Changed;
+		});
+	}
+};
+
+/**
+ * Delegate to broadcast that specific items of the provider changed.
+ * Lets listeners patch only the affected entries instead of re-fetching every item.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDataProviderDelta, const FStrategyDataProviderDelta&, Delta);
+
+/** Delegate to broadcast that an asynchronously fetched page of a paged provider (IStrategyPagedDataProvider) is ready. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDataProviderPageLoaded, int32, PageIndex, const TArray<UObject*>&, PageItems);
+
 /*
  * Wrapper for the dynamic multicast delegate to allow it to be exposed to Blueprints.
  *
@@ -26,6 +102,14 @@ class UOnDataProviderUpdatedDelegateWrapper : public UObject
 public:
 	UPROPERTY(BlueprintAssignable, Category = "StrategyUI|Delegates")
 	FOnDataProviderUpdated OnDataProviderUpdatedDelegate;
+
+	/** Optional, broadcast instead of OnDataProviderUpdatedDelegate by providers that support delta updates. */
+	UPROPERTY(BlueprintAssignable, Category = "StrategyUI|Delegates")
+	FOnDataProviderDelta OnDataProviderDeltaDelegate;
+
+	/** Only used by paged providers, broadcast when a page FetchItemPage returned false for has been fetched. */
+	UPROPERTY(BlueprintAssignable, Category = "StrategyUI|Delegates")
+	FOnDataProviderPageLoaded OnDataProviderPageLoadedDelegate;
 };
 
 /**
@@ -72,4 +156,27 @@ public:
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyDataProvider")
 	UOnDataProviderUpdatedDelegateWrapper* GetOnDataProviderUpdated();
+
+	/**
+	 * Return a single data item, used by listeners applying a delta.
+	 * The default goes through GetDataItems(), override it when broadcasting deltas to avoid copying every item.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyDataProvider")
+	UObject* GetDataItemAt(int32 Index) const;
+	virtual UObject* GetDataItemAt_Implementation(const int32 Index) const
+	{
+		const TArray<UObject*> DataItems = Execute_GetDataItems(_getUObject());
+		return DataItems.IsValidIndex(Index) ? DataItems[Index] : nullptr;
+	}
+
+	/**
+	 * Return the number of data items, used by listeners to validate a delta (and to size paged providers).
+	 * The default goes through GetDataItems(), override it when broadcasting deltas to avoid copying every item.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyDataProvider")
+	int32 GetDataItemCount() const;
+	virtual int32 GetDataItemCount_Implementation() const
+	{
+		return Execute_GetDataItems(_getUObject()).Num();
+	}
 };
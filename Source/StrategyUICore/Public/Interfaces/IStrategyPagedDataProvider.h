@@ -0,0 +1,48 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/Interface.h>
+
+#include "IStrategyPagedDataProvider.generated.h"
+
+/**
+ * Optional companion to IStrategyDataProvider for very large item sets.
+ *
+ * A provider implementing both hands its items out a page at a time instead of through GetDataItems().
+ * The widget sizes its items from GetDataItemCount() and only fetches the pages its visible window maps to,
+ * so items (and their UObjects) only need to exist for the handful of pages that are on screen.
+ *
+ * Deltas (OnDataProviderDeltaDelegate) work as usual; changed items are re-read through GetDataItemAt() for pages
+ * the widget holds, and structural changes have it refetch the pages of its window.
+ */
+UINTERFACE(BlueprintType, Blueprintable)
+class STRATEGYUI_API UStrategyPagedDataProvider : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class IStrategyPagedDataProvider : public IInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of items per page. Page N covers data indices [N * PageSize, (N + 1) * PageSize). */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyPagedDataProvider")
+	int32 GetItemPageSize() const;
+	virtual int32 GetItemPageSize_Implementation() const { return 64; }
+
+	/**
+	 * Fetch the items of a page.
+	 * Return true with OutItems filled if they're available right away. Return false to fetch them asynchronously,
+	 * then broadcast OnDataProviderPageLoadedDelegate on the delegate wrapper with the page's items once they're ready.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyPagedDataProvider")
+	bool FetchItemPage(int32 PageIndex, TArray<UObject*>& OutItems);
+
+	/** The widget no longer holds a page (it scrolled away), the provider may free its items or cancel its fetch. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="StrategyUI|StrategyPagedDataProvider")
+	void ReleaseItemPage(int32 PageIndex);
+	virtual void ReleaseItemPage_Implementation(const int32 PageIndex) {}
+};
@@ -44,6 +44,16 @@ public:
 	{
 		return DelegateWrapper;
 	};
+
+	virtual UObject* GetDataItemAt_Implementation(const int32 Index) const override
+	{
+		return DebugItems.IsValidIndex(Index) ? DebugItems[Index].Get() : nullptr;
+	}
+
+	virtual int32 GetDataItemCount_Implementation() const override
+	{
+		return DebugItems.Num();
+	}
 	// ~ End IStrategyDataProvider interface
 
 private:
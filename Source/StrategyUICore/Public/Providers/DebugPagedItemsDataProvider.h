@@ -0,0 +1,102 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Ticker.h>
+#include <UObject/Object.h>
+
+#include "Interfaces/IStrategyDataProvider.h"
+#include "Interfaces/IStrategyPagedDataProvider.h"
+#include "DebugPagedItemsDataProvider.generated.h"
+
+/** One page of debug items, kept in a map since UHT can't reflect nested containers. */
+USTRUCT()
+struct FStrategyDebugItemPage
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> Items;
+};
+
+/**
+ * Paged data provider that only creates debug items for the pages a widget asks for, useful for testing very large
+ * item sets. Pages can be handed out with a simulated fetch delay to exercise the asynchronous path.
+ */
+UCLASS(Blueprintable, EditInlineNew, Category="StrategyUI|Providers")
+class STRATEGYUI_API UDebugPagedItemsDataProvider : public UObject, public IStrategyDataProvider, public IStrategyPagedDataProvider
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Number of debug items reported, none of them exist until their page is fetched */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|Debug", meta=(ClampMin="0"))
+	int32 DebugItemCount = 50000;
+
+	/** Number of items per page */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|Debug", meta=(ClampMin="1"))
+	int32 PageSize = 64;
+
+	/** Seconds before a fetched page is handed out, 0 hands pages out immediately */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|Debug", meta=(ClampMin="0", Units="Seconds"))
+	float SimulatedFetchDelay = 0.f;
+
+	// ~ Begin IStrategyDataProvider interface
+	virtual TArray<UObject*> GetDataItems_Implementation() const override
+	{
+		return {}; // Items are only handed out by page
+	}
+
+	virtual bool IsProviderReady_Implementation() const override
+	{
+		return IsValid(DelegateWrapper);
+	}
+
+	virtual void InitializeDataProvider_Implementation() override;
+
+	virtual UOnDataProviderUpdatedDelegateWrapper* GetOnDataProviderUpdated_Implementation() override
+	{
+		return DelegateWrapper;
+	}
+
+	virtual UObject* GetDataItemAt_Implementation(int32 Index) const override;
+
+	virtual int32 GetDataItemCount_Implementation() const override
+	{
+		return DebugItemCount;
+	}
+	// ~ End IStrategyDataProvider interface
+
+	// ~ Begin IStrategyPagedDataProvider interface
+	virtual int32 GetItemPageSize_Implementation() const override
+	{
+		return PageSize;
+	}
+
+	virtual bool FetchItemPage_Implementation(int32 PageIndex, TArray<UObject*>& OutItems) override;
+	virtual void ReleaseItemPage_Implementation(int32 PageIndex) override;
+	// ~ End IStrategyPagedDataProvider interface
+
+private:
+	/** Creates the debug items of a page, or returns the existing ones. */
+	const FStrategyDebugItemPage& GetOrCreatePage(int32 PageIndex);
+
+	/** Pages that currently exist, by page index. */
+	UPROPERTY()
+	TMap<int32, FStrategyDebugItemPage> Pages;
+
+	/** Pages waiting out SimulatedFetchDelay, released pages are dropped from here. */
+	TMap<int32, FTSTicker::FDelegateHandle> DelayedFetches;
+
+	/**
+	 * Delegate to broadcast changes to our data set
+	 */
+	UPROPERTY(Transient)
+	TObjectPtr<UOnDataProviderUpdatedDelegateWrapper> DelegateWrapper;
+};
@@ -8,6 +8,13 @@
 
 #include "StrategyUIProjectSettings.generated.h"
 
+/** Everything mapped to one tag in the project settings. */
+struct FStrategyUITagWidgetClasses
+{
+	TSubclassOf<UUserWidget> WidgetClass = nullptr;
+	TSoftClassPtr<UUserWidget> WidgetSoftClass = nullptr;
+};
+
 /**
  * Configure in Project Settings > Plugins > Strategy UI Settings.
  */
@@ -22,6 +29,39 @@ public:
 		return GetDefault<UStrategyUIProjectSettings>();
 	}
 
+	/**
+	 * Finds what TagToWidgetClassMap and TagToWidgetSoftClassMap map Tag to, with a single lookup in a table flattened
+	 * from both maps. The table is built on first use and rebuilt whenever the settings change.
+	 */
+	const FStrategyUITagWidgetClasses* FindWidgetClassesForTag(const FGameplayTag& Tag) const
+	{
+		if (!bTagLookupBuilt)
+		{
+			RebuildTagLookup();
+		}
+		return TagLookup.Find(Tag);
+	}
+
+	virtual void PostInitProperties() override
+	{
+		Super::PostInitProperties();
+		bTagLookupBuilt = false;
+	}
+
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override
+	{
+		Super::PostReloadConfig(PropertyThatWasLoaded);
+		bTagLookupBuilt = false;
+	}
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override
+	{
+		Super::PostEditChangeProperty(PropertyChangedEvent);
+		bTagLookupBuilt = false;
+	}
+#endif
+
 	/** If true, we log a warning any time we fail to find a widget class for a given tag. */
 	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|Logging")
 	bool bWarnOnMissingClass = true;
@@ -40,6 +80,44 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|WidgetMapping")
 	TMap<FGameplayTag, TSoftClassPtr<UUserWidget>> TagToWidgetSoftClassMap;
 
+	/**
+	 * If true, every strategy widget starts warming its entry widget pools (see UBaseStrategyWidget::WarmUpEntryWidgetPools)
+	 * as soon as it's initialized, before it's ever constructed. Create menus during a loading screen to hide the cost.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|PoolWarmUp")
+	bool bWarmUpEntryPoolsOnInitialize = false;
+
+	/** Widgets pre-instantiated per entry widget class by a warm-up. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|PoolWarmUp", meta=(ClampMin="1"))
+	int32 WarmUpWidgetsPerClass = 8;
+
+	/** Time a warm-up may spend creating widgets each frame. At least one widget is created per frame regardless. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|PoolWarmUp", meta=(ClampMin="0.1", Units="ms"))
+	float WarmUpFrameBudgetMs = 2.f;
+
+	/** If true, warm-ups also cover every class in TagToWidgetClassMap and TagToWidgetSoftClassMap. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|PoolWarmUp")
+	bool bWarmUpTagMappedClasses = true;
+
+	/**
+	 * Most free entry widgets kept in the shared entry pool (UStrategyEntryPoolSubsystem), across all strategy widgets
+	 * and classes. The least recently released ones are dropped past this, for GC to collect. 0 disables sharing free entries.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|Pooling", meta=(ClampMin="0"))
+	int32 MaxPooledEntryWidgets = 128;
+
+	/** Most free entry widgets of any single class kept in the shared entry pool. -1 only applies the total budget. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|Pooling", meta=(ClampMin="-1"))
+	int32 MaxPooledEntryWidgetsPerClass = 16;
+
+	/** Free entry widgets left unused in the shared pool for longer than this are trimmed. 0 never trims idle widgets. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|Pooling", meta=(ClampMin="0", Units="Seconds"))
+	float PooledEntryWidgetIdleTrimSeconds = 60.f;
+
+	/** If true, the shared entry pool is trimmed entirely when the platform signals memory pressure. */
+	UPROPERTY(EditAnywhere, Config, Category="StrategyUI|Pooling")
+	bool bTrimEntryPoolOnMemoryWarning = true;
+
 	virtual FName GetCategoryName() const override
 	{
 		return FName(TEXT("Plugins"));
@@ -49,4 +127,24 @@ public:
 	{
 		return FName(TEXT("Strategy UI"));
 	}
+
+private:
+	void RebuildTagLookup() const
+	{
+		TagLookup.Reset();
+		TagLookup.Reserve(TagToWidgetClassMap.Num() + TagToWidgetSoftClassMap.Num());
+		for (const TPair<FGameplayTag, TSubclassOf<UUserWidget>>& Pair : TagToWidgetClassMap)
+		{
+			TagLookup.FindOrAdd(Pair.Key).WidgetClass = Pair.Value;
+		}
+		for (const TPair<FGameplayTag, TSoftClassPtr<UUserWidget>>& Pair : TagToWidgetSoftClassMap)
+		{
+			TagLookup.FindOrAdd(Pair.Key).WidgetSoftClass = Pair.Value;
+		}
+		bTagLookupBuilt = true;
+	}
+
+	/** TagToWidgetClassMap and TagToWidgetSoftClassMap, flattened */
+	mutable TMap<FGameplayTag, FStrategyUITagWidgetClasses> TagLookup;
+	mutable bool bTagLookupBuilt = false;
 };
@@ -7,7 +7,10 @@
 #include "Interfaces/ILayoutStrategyHost.h"
 #include "BaseLayoutStrategy.generated.h"
 
+// Max number of full entry widgets alive at once
 #define MAX_ENTRY_COUNT 256
+// Max size of the desired window for hosts using entry proxies; entries past MAX_ENTRY_COUNT are drawn as proxies (see UBaseStrategyWidget::ShouldUseEntryProxy)
+#define MAX_WINDOW_ENTRY_COUNT 4096
 
 class UWidget;
 
@@ -31,7 +34,10 @@ public:
 	{
 		UObject::PostEditChangeProperty(PropertyChangedEvent);
 
-		MaxVisibleEntries = FMath::Clamp(MaxVisibleEntries, 1, MAX_ENTRY_COUNT);
+		// Only a host drawing far entries as proxies can afford a window past MAX_ENTRY_COUNT, since it only gives real
+		// widgets to the MAX_ENTRY_COUNT entries closest to focus. Without proxies every entry in the window gets one.
+		CacheHostUsesEntryProxies(GetOuter());
+		MaxVisibleEntries = FMath::Clamp(MaxVisibleEntries, 1, GetMaxWindowEntryCount());
 	}
 #endif
 
@@ -42,7 +48,9 @@ public:
 	 * Maximum number of visible entries at once.
 	 * If Items.Num() exceeds this value, we only display a subset "visible window" that is determined by ComputeDesiredIndices.
 	 * 
-	 * This value is clamped to MAX_ENTRY_COUNT (default 256) to prevent performance issues with an extreme number of widgets.
+	 * This value is clamped to MAX_ENTRY_COUNT (default 256). With entry proxies (see UBaseStrategyWidget::bUseEntryProxies)
+	 * it's clamped to MAX_WINDOW_ENTRY_COUNT (default 4096) instead; at most MAX_ENTRY_COUNT of them get a real widget,
+	 * the rest are drawn as lightweight proxies.
 	 *
 	 * The StrategyUI plugin efficiently handles a large number of entries. However, the more widgets you have active at once, the bigger the performance hit.
 	 */
@@ -73,9 +81,13 @@ public:
 	 */
 	virtual void InitializeStrategy(TScriptInterface<ILayoutStrategyHost> Host)
 	{
-		MaxVisibleEntries = FMath::Clamp(MaxVisibleEntries, 1, MAX_ENTRY_COUNT);
+		CacheHostUsesEntryProxies(Host.GetObject());
+		MaxVisibleEntries = FMath::Clamp(MaxVisibleEntries, 1, GetMaxWindowEntryCount());
 	};
 
+	/** Most entries the desired window may span: MAX_WINDOW_ENTRY_COUNT if the host uses entry proxies, MAX_ENTRY_COUNT otherwise. */
+	int32 GetMaxWindowEntryCount() const { return bHostUsesEntryProxies ? MAX_WINDOW_ENTRY_COUNT : MAX_ENTRY_COUNT; }
+
 	/**
 	 * Validates the strategy properties and settings.
 	 * This is called during widget compilation to ensure the strategy is set up correctly.
@@ -85,19 +97,108 @@ public:
 	/** Get the position for a given item index. */
 	virtual FVector2D GetItemPosition(int32 GlobalIndex) const { return FVector2D::ZeroVector; }
 
+	/**
+	 * Batched GetItemPosition for a contiguous window of global indices, given as [Lower, Upper) bounds.
+	 * OutPositions[i] receives the position of global index (Lower + i); at most OutPositions.Num() positions are written.
+	 *
+	 * The default just loops over GetItemPosition. Override to evaluate the whole window at once (e.g. vectorized sin/cos).
+	 */
+	virtual void ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const
+	{
+		if (GlobalIndexRange.IsEmpty())
+		{
+			return;
+		}
+
+		const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+		const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutPositions.Num());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutPositions[i] = GetItemPosition(FirstGlobalIndex + i);
+		}
+	}
+
 	/**
 	 * Get the currently focused global index.
 	 * "Focused" can mean different things depending on the layout strategy.
 	 * For example, in a radial layout, it might be the item closest to the radial pointer.
-	 * In a world marker layout, it might be an item near the crosshair location. //@TODO: Implement this
+	 * In a world marker layout, it might be an item near the crosshair location (see PickGlobalIndexAtLocalPosition).
 	 */
 	virtual int32 FindFocusedGlobalIndex() const { return 0; }
 
 	/**
-	 * Returns the set of desired global indices to display.
-	 * Best to call UpdateVisibleWindow before this to ensure the window is up-to-date.
+	 * How many entries apart two global indices are in this layout, e.g. for deciding how far an entry is from focus.
+	 * Layouts that wrap around (like a wheel) should measure the shorter way around.
+	 */
+	virtual int32 GetGlobalIndexDistance(const int32 GlobalIndexA, const int32 GlobalIndexB) const { return FMath::Abs(GlobalIndexA - GlobalIndexB); }
+
+	/**
+	 * Returns the contiguous window of desired global indices to display, as [Lower, Upper) bounds.
+	 * The owning widget diffs consecutive windows to find entering/leaving entries without building a set.
+	 *
+	 * Return an empty range if the desired indices aren't contiguous; the widget then falls back to ComputeDesiredGlobalIndices.
+	 */
+	virtual FInt32Range ComputeDesiredGlobalIndexRange() { return FInt32Range::Empty(); }
+
+	/**
+	 * Returns the set of desired global indices to display (DesiredGlobalIndices).
+	 * By default, expands ComputeDesiredGlobalIndexRange(). When the range slides, only the entries leaving and entering
+	 * it are removed/added, so a one-entry step costs two set operations rather than a rebuild.
+	 * Override for layouts with a non-contiguous window.
 	 */
-	virtual TSet<int32> ComputeDesiredGlobalIndices() { return TSet<int32>(); }
+	virtual const TSet<int32>& ComputeDesiredGlobalIndices()
+	{
+		const FInt32Range DesiredRange = ComputeDesiredGlobalIndexRange();
+		const int32 DesiredCount = FMath::Max(DesiredRange.Size<int32>(), 0);
+		const int32 PreviousCount = FMath::Max(DesiredGlobalIndicesRange.Size<int32>(), 0);
+		if (DesiredRange == DesiredGlobalIndicesRange && DesiredGlobalIndices.Num() == DesiredCount)
+		{
+			return DesiredGlobalIndices;
+		}
+
+		const bool bCanSlide = DesiredCount > 0
+			&& PreviousCount > 0
+			&& DesiredGlobalIndices.Num() == PreviousCount
+			&& !FInt32Range::Intersection(DesiredRange, DesiredGlobalIndicesRange).IsEmpty();
+		if (bCanSlide)
+		{
+			const int32 Lower = DesiredRange.GetLowerBoundValue();
+			const int32 Upper = DesiredRange.GetUpperBoundValue();
+			const int32 PreviousLower = DesiredGlobalIndicesRange.GetLowerBoundValue();
+			const int32 PreviousUpper = DesiredGlobalIndicesRange.GetUpperBoundValue();
+
+			// Drop what left either end, then add what entered either end
+			for (int32 GlobalIndex = PreviousLower; GlobalIndex < Lower; ++GlobalIndex)
+			{
+				DesiredGlobalIndices.Remove(GlobalIndex);
+			}
+			for (int32 GlobalIndex = Upper; GlobalIndex < PreviousUpper; ++GlobalIndex)
+			{
+				DesiredGlobalIndices.Remove(GlobalIndex);
+			}
+			for (int32 GlobalIndex = Lower; GlobalIndex < PreviousLower; ++GlobalIndex)
+			{
+				DesiredGlobalIndices.Add(GlobalIndex);
+			}
+			for (int32 GlobalIndex = PreviousUpper; GlobalIndex < Upper; ++GlobalIndex)
+			{
+				DesiredGlobalIndices.Add(GlobalIndex);
+			}
+		}
+		else
+		{
+			DesiredGlobalIndices.Reset();
+			if (!DesiredRange.IsEmpty())
+			{
+				for (int32 GlobalIndex = DesiredRange.GetLowerBoundValue(); GlobalIndex < DesiredRange.GetUpperBoundValue(); ++GlobalIndex)
+				{
+					DesiredGlobalIndices.Add(GlobalIndex);
+				}
+			}
+		}
+		DesiredGlobalIndicesRange = DesiredRange;
+		return DesiredGlobalIndices;
+	}
 
 	/**
 	 * Converts a global index into the actual item index.
@@ -111,6 +212,26 @@ public:
 	 */
 	virtual bool ShouldBeVisible(const int32 GlobalIndex) const { return true; };
 	
+	//--------------------------------------------------------------------------
+	// BaseLayoutStrategy API - picking
+	//--------------------------------------------------------------------------
+	/**
+	 * Returns the global index of the entry closest to LocalPoint (in the same space as GetItemPosition, i.e. relative to
+	 * the layout center) that is no further than PickRadius from its position, or INDEX_NONE.
+	 * Only entries last passed to UpdatePickIndex can be picked; looking them up goes through the spatial index, so the
+	 * cost doesn't grow with the number of entries.
+	 */
+	int32 PickGlobalIndexAtLocalPosition(const FVector2D& LocalPoint, float PickRadius) const;
+
+	/**
+	 * Tells the pick index where the entries currently laid out are (Positions[i] being the position of GlobalIndices[i]).
+	 * Called by the owning widget whenever it pushes positions to the panel; the index is only rebuilt when they changed.
+	 */
+	void UpdatePickIndex(TConstArrayView<int32> GlobalIndices, TConstArrayView<FVector2D> Positions);
+
+	/** Forgets every indexed entry, e.g. once the owning widget has nothing laid out anymore. */
+	void InvalidatePickIndex();
+
 	/**
 	 * Draws debug visuals for the layout strategy.
 	 * This is useful for visualizing the layout in the editor or during development.
@@ -118,4 +239,57 @@ public:
 	 * Called automatically by FLayoutStrategyDebugPaintUtil::DrawLayoutStrategyDebugVisuals if using that utility.
 	 */
 	virtual void DrawDebugVisuals(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FVector2D& Center) const {};
+
+protected:
+	/** Caches whether Host (an ILayoutStrategyHost, or anything else) uses entry proxies, for GetMaxWindowEntryCount. */
+	void CacheHostUsesEntryProxies(const UObject* Host)
+	{
+		bHostUsesEntryProxies = Host && Host->Implements<ULayoutStrategyHost>() && ILayoutStrategyHost::Execute_UsesEntryProxies(Host);
+	}
+
+	/**
+	 * Rebuilds the spatial index over PickPositions. By default a uniform grid sized to the entries' bounds and density
+	 * (see PickGridCellSize); layouts with a more natural partition override this together with PickFromIndex.
+	 */
+	virtual void RebuildPickIndex();
+
+	/** Looks LocalPoint up in the index built by RebuildPickIndex, returning the picked entry (an index into PickPositions) or INDEX_NONE. */
+	virtual int32 PickFromIndex(const FVector2D& LocalPoint, float PickRadius) const;
+
+	/**
+	 * Sorts the indexed entries into NumBuckets buckets (bucketed by GetBucket, which must return [0, NumBuckets)), so that
+	 * the entries of bucket B are PickBucketEntries[PickBucketStarts[B] .. PickBucketStarts[B + 1]).
+	 */
+	void BuildPickBuckets(int32 NumBuckets, TFunctionRef<int32(const FVector2D&)> GetBucket);
+
+	/** Finds the entry of Bucket closest to LocalPoint if closer than sqrt(InOutBestDistanceSquared), updating it. */
+	int32 FindClosestInPickBucket(int32 Bucket, const FVector2D& LocalPoint, float& InOutBestDistanceSquared, int32 BestEntry) const;
+
+	/**
+	 * Cell size of the default pick grid, in layout units. 0 sizes cells to the average spacing of the entries.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseLayoutStrategy|Picking", meta=(ClampMin="0.0"))
+	float PickGridCellSize = 0.f;
+
+	/** Whether the host last initialized with draws far entries as proxies (see GetMaxWindowEntryCount). */
+	bool bHostUsesEntryProxies = false;
+
+	/** The range DesiredGlobalIndices was last expanded from by the default ComputeDesiredGlobalIndices. */
+	FInt32Range DesiredGlobalIndicesRange = FInt32Range::Empty();
+
+	/** The entries the pick index was built over. */
+	TArray<int32> PickGlobalIndices;
+	TArray<FVector2D> PickPositions;
+
+	/** Buckets of the pick index (see BuildPickBuckets). */
+	TArray<int32> PickBucketStarts;
+	TArray<int32> PickBucketEntries;
+
+	/** Bucket of each entry, scratch for BuildPickBuckets. */
+	TArray<int32> PickEntryBuckets;
+
+	/** The default pick grid: its origin, cell size and cells per row/column. */
+	FVector2D PickGridOrigin = FVector2D::ZeroVector;
+	float PickGridResolvedCellSize = 0.f;
+	FIntPoint PickGridDims = FIntPoint::ZeroValue;
 };
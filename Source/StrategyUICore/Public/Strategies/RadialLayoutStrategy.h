@@ -8,6 +8,36 @@
 #include "Interfaces/ILayoutStrategyHost.h"
 #include "RadialLayoutStrategy.generated.h"
 
+/**
+ * A copy of what a radial layout needs to lay out entries with the pointer at one angle (see
+ * URadialLayoutStrategy::MakeLayoutSnapshot). It only reads its own members, so it can be evaluated on any thread
+ * while the strategy keeps changing on the game thread.
+ *
+ * The defaults describe evenly spaced entries on a circle of BaseRadius; layouts with more inputs extend it.
+ */
+struct STRATEGYUI_API FRadialLayoutSnapshot
+{
+	virtual ~FRadialLayoutSnapshot() = default;
+
+	/** Pointer angle the snapshot lays out for, already sanitized by the strategy. */
+	float PointerAngle = 0.f;
+	float AngularSpacing = 0.f;
+	float BaseRadius = 0.f;
+	float MinRadius = 0.f;
+	float MaxRadius = 0.f;
+	int32 NumItems = 0;
+	int32 GapPaddingSegments = 0;
+
+	/** See URadialLayoutStrategy::CalculateItemAngleDegreesForGlobalIndex. */
+	virtual float GetItemAngleDegrees(const int32 GlobalIndex) const { return GlobalIndex * AngularSpacing; }
+
+	/** See URadialLayoutStrategy::CalculateDistanceFactorForGlobalIndex. Defaults to every entry at the pointer's depth. */
+	virtual float GetDistanceFactor(const int32 GlobalIndex) const { return 0.5f; }
+
+	/** See URadialLayoutStrategy::CalculateRadiusForGlobalIndex. */
+	virtual float GetRadius(const int32 GlobalIndex) const { return BaseRadius; }
+};
+
 
 UCLASS(Abstract, ClassGroup="StrategyUI|RadialLayout")
 class STRATEGYUI_API URadialLayoutStrategy : public UBaseLayoutStrategy
@@ -42,10 +72,10 @@ public:
 	virtual void ValidateStrategy(TArray<FText>& OutErrors) const override;
 
 	/**
-	 * Returns the set of desired global indices to display in the current visible window.
-	 * Best to call UpdateVisibleWindow before this to ensure the window is up-to-date.
+	 * Returns the window of desired global indices to display.
+	 * In a basic radial layout, every segment is desired.
 	 */
-	virtual TSet<int32> ComputeDesiredGlobalIndices() override;
+	virtual FInt32Range ComputeDesiredGlobalIndexRange() override;
 	
 	/**
 	 * In a basic radial setup, the global index should map directly to the data index.
@@ -81,6 +111,24 @@ public:
 	 * For an infinite spiral, this can be unbounded.
 	 */
 	virtual float SanitizeAngle(const float InAngle) const;
+
+	/**
+	 * The global index the pointer would focus if it were at InAngle (FindFocusedGlobalIndex for any angle).
+	 * The default picks the wedge InAngle falls in, with wedges centered on their item.
+	 */
+	virtual int32 FindGlobalIndexForAngle(const float InAngle) const;
+
+	/**
+	 * The range ComputeDesiredGlobalIndexRange would return if the pointer were at InAngle, without touching the
+	 * layout's state. Used to look ahead, e.g. to prefetch the entries an animated scroll will pass through.
+	 */
+	virtual FInt32Range ComputeDesiredGlobalIndexRangeForAngle(const float InAngle) const;
+
+	/**
+	 * How many deactivated entries pad the visible window below (OutLowerMargin) and above (OutUpperMargin) it.
+	 * The default is NumDeactivatedEntries on both sides.
+	 */
+	virtual void GetDeactivatedMargins(int32& OutLowerMargin, int32& OutUpperMargin) const;
 	
 
 	/** 
@@ -115,6 +163,26 @@ public:
 	virtual float GetMinRadius() const { return BaseRadius; }
 	virtual float GetMaxRadius() const { return BaseRadius; }
 
+	/**
+	 * Copies the inputs of this layout with the pointer at InPointerAngle into a snapshot that can be evaluated off the
+	 * game thread (e.g. by URadialStrategyWidget::bComputeLayoutOffGameThread).
+	 * Returns null if the layout can't be described by one, like the default here whose per-index functions may be
+	 * overridden in ways a snapshot knows nothing about; callers then stay on the game thread.
+	 */
+	virtual TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> MakeLayoutSnapshot(const float InPointerAngle) const { return nullptr; }
+
+	/**
+	 * Batched CalculateItemAngleDegreesForGlobalIndex over [Lower, Upper) (see ComputeItemPositions).
+	 * The default loops over the per-index function.
+	 */
+	virtual void ComputeItemAnglesDegrees(const FInt32Range& GlobalIndexRange, TArrayView<float> OutAnglesDegrees) const;
+
+	/**
+	 * Batched CalculateDistanceFactorForGlobalIndex over [Lower, Upper) (see ComputeItemPositions).
+	 * The default loops over the per-index function.
+	 */
+	virtual void ComputeDistanceFactors(const FInt32Range& GlobalIndexRange, TArrayView<float> OutDistanceFactors) const;
+
 	//----------------------------------------------------------------------------------------------
 	// Radial Layout Strategy API - Getters and Setters
 	//----------------------------------------------------------------------------------------------
@@ -141,6 +209,18 @@ public:
 	 */
 	float GetPointerAngle() const { return LatestPointerAngle; }
 
+	/**
+	 * Sets how fast the pointer is turning from user input, in degrees per second (positive = increasing angle).
+	 * Layouts can use this to look ahead of the motion (see USpiralLayoutStrategy::bUseAdaptiveDeactivatedMargin).
+	 */
+	void SetPointerAngularVelocity(const float InDegreesPerSecond)
+	{
+		LatestPointerAngularVelocity = InDegreesPerSecond;
+	}
+
+	/** Gets how fast the pointer is turning from user input, in degrees per second (positive = increasing angle). */
+	float GetPointerAngularVelocity() const { return LatestPointerAngularVelocity; }
+
 	/**
 	 * Gets the number of "gap segments" to add after the last item.
 	 * This is useful for maintaining consistent spacing if we have fewer items than segments.
@@ -163,6 +243,22 @@ public:
 	int32 GetVisibleEndIndex() const { return VisibleEndIndex; }
 
 protected:
+	/**
+	 * Converts polar coordinates (degrees, radius) to positions, four at a time with vectorized sin/cos.
+	 * Writes min(AnglesDegrees.Num(), Radii.Num(), OutPositions.Num()) positions.
+	 */
+	static void ComputePolarPositions(TConstArrayView<float> AnglesDegrees, TConstArrayView<float> Radii, TArrayView<FVector2D> OutPositions);
+
+	/** Fills in the members every FRadialLayoutSnapshot shares, for MakeLayoutSnapshot overrides. */
+	void FillLayoutSnapshot(FRadialLayoutSnapshot& OutSnapshot, const float InPointerAngle) const;
+
+	/** Picking buckets entries by their angle around the center, so a pick only looks at the buckets its angle spans. */
+	virtual void RebuildPickIndex() override;
+	virtual int32 PickFromIndex(const FVector2D& LocalPoint, float PickRadius) const override;
+
+	/** Angular buckets of the pick index, each 360 / NumPickAngleBuckets degrees wide starting at 0°. */
+	int32 NumPickAngleBuckets = 0;
+
 	//----------------------------------------------------------------------------------------------
 	// Runtime Properties
 	//----------------------------------------------------------------------------------------------
@@ -199,4 +295,8 @@ protected:
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|RadialStrategy|Input")
 	float LatestPointerAngle = 0.f;
+
+	/** How fast the pointer is turning from user input, in degrees per second (positive = increasing angle). */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|RadialStrategy|Input")
+	float LatestPointerAngularVelocity = 0.f;
 };
\ No newline at end of file
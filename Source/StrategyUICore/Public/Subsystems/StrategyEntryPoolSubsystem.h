@@ -0,0 +1,184 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Ticker.h>
+#include <Subsystems/GameInstanceSubsystem.h>
+#include <UObject/ObjectKey.h>
+
+#include "StrategyEntryPoolSubsystem.generated.h"
+
+class APlayerController;
+class UAsyncWidgetLoaderSubsystem;
+class UUserWidget;
+
+/** Pool statistics for one entry widget class, or all of them. */
+USTRUCT(BlueprintType)
+struct STRATEGYUI_API FStrategyEntryPoolStats
+{
+	GENERATED_BODY()
+
+	/** The class these stats are for, null for totals. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	TSubclassOf<UUserWidget> WidgetClass = nullptr;
+
+	/** Free widgets currently in the pool. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	int32 NumPooled = 0;
+
+	/** Acquires served by a free pooled widget. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	int32 NumHits = 0;
+
+	/** Acquires that found no free widget and fell back to the loader. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	int32 NumMisses = 0;
+
+	/** Distinct widget instances the loader handed out for this class so far. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	int32 NumInstantiated = 0;
+
+	/** Free widgets dropped by budgets, idle trimming, memory pressure or world cleanup. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|EntryPool")
+	int32 NumTrimmed = 0;
+
+	float GetHitRatio() const
+	{
+		const int32 NumAcquires = NumHits + NumMisses;
+		return NumAcquires > 0 ? static_cast<float>(NumHits) / NumAcquires : 0.f;
+	}
+
+	void Accumulate(const FStrategyEntryPoolStats& Other)
+	{
+		NumPooled += Other.NumPooled;
+		NumHits += Other.NumHits;
+		NumMisses += Other.NumMisses;
+		NumInstantiated += Other.NumInstantiated;
+		NumTrimmed += Other.NumTrimmed;
+	}
+};
+
+/** Free entry widgets of one class, least recently released first. */
+USTRUCT()
+struct FStrategyEntryPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> FreeWidgets;
+
+	/** FPlatformTime::Seconds() at which each of FreeWidgets was released. */
+	TArray<double> ReleaseTimes;
+
+	/** Every instance the loader handed out for this class, to count instantiations. */
+	TSet<FObjectKey> KnownWidgets;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumTrimmed = 0;
+};
+
+/**
+ * Game-instance-wide pool of free entry widgets, shared by every strategy widget.
+ *
+ * Strategy widgets only ever hand their own entries back here (including when they're reset or destructed), so
+ * closing one menu never throws away the warm entries of another. Free widgets are reused most recently released
+ * first. The pool is bounded by the budgets in UStrategyUIProjectSettings (per class and in total), and trimmed of
+ * widgets left unused for too long or on memory pressure. Trimmed widgets are dropped for good: their Slate resources
+ * are released and the AsyncWidgetLoader is made to forget them, so nothing keeps them alive past the next GC.
+ */
+UCLASS()
+class STRATEGYUI_API UStrategyEntryPoolSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Takes the most recently released free widget of WidgetClass that was created for World and OwningPlayer.
+	 * Returns null if there's none, the caller should create (or request) one instead.
+	 * @param bRecordStats  False for acquires that aren't real demand (e.g. pool warm-ups), to keep the hit ratio honest.
+	 */
+	UUserWidget* AcquireWidget(TSubclassOf<UUserWidget> WidgetClass, const UWorld* World, const APlayerController* OwningPlayer, bool bRecordStats = true);
+
+	/** Hands a widget its owner no longer uses back to the pool. The owner must not touch it afterwards. */
+	void ReleaseWidget(UUserWidget* Widget);
+
+	/** Lets the pool count a widget the loader handed out (created or reused from its own pool) in its statistics. */
+	void NotifyWidgetFromLoader(const UUserWidget* Widget);
+
+	/** Hands every free widget back to the AsyncWidgetLoader. Widgets in use are unaffected. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|EntryPool")
+	void EmptyPool();
+
+	/**
+	 * Trims free widgets down to the given budgets, least recently released first.
+	 * Negative budgets fall back to the project settings, 0 trims everything.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|EntryPool")
+	void TrimPool(int32 MaxTotalWidgets = -1, int32 MaxWidgetsPerClass = -1);
+
+	/** Number of free widgets currently pooled, across all classes. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|EntryPool")
+	int32 GetNumPooledWidgets() const { return NumPooledWidgets; }
+
+	/** Statistics per entry widget class the pool has seen. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|EntryPool")
+	TArray<FStrategyEntryPoolStats> GetPoolStatsPerClass() const;
+
+	/** Statistics summed over every class. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|EntryPool")
+	FStrategyEntryPoolStats GetTotalPoolStats() const;
+
+	/** Forgets hit/miss/instantiation/trim counts (pooled counts stay). */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|EntryPool")
+	void ResetPoolStats();
+
+	/** Logs GetPoolStatsPerClass() and the totals. */
+	void DumpPoolStats() const;
+
+private:
+	/** Hands the least recently released free widget (of Bucket, or across all classes if null) back to the loader. */
+	void TrimLeastRecentlyReleased(FStrategyEntryPoolBucket* Bucket = nullptr);
+
+	/** Drops the free widget of Bucket at FreeIndex (see ReleaseTrimmedWidgets). */
+	void TrimWidgetAt(FStrategyEntryPoolBucket& Bucket, int32 FreeIndex);
+
+	/** Periodically trims widgets left in the pool for longer than PooledEntryWidgetIdleTrimSeconds. */
+	bool TickIdleTrim(float DeltaTime);
+
+	/** Trims everything when the platform asks to free memory. */
+	void OnMemoryTrim();
+
+	/** Free widgets can't outlive the world they were created in. */
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	/** Hands a widget back to the AsyncWidgetLoader's pool with its Slate resources released. */
+	void ReturnWidgetToLoader(UUserWidget* Widget) const;
+
+	/**
+	 * Makes the AsyncWidgetLoader let go of the widgets trimmed since the last call, leaving them to GC.
+	 * The loader can only forget its pools as a whole; whatever else it had free is recreated on demand.
+	 */
+	void ReleaseTrimmedWidgets();
+
+	FStrategyEntryPoolStats MakeStats(TSubclassOf<UUserWidget> WidgetClass, const FStrategyEntryPoolBucket& Bucket) const;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UAsyncWidgetLoaderSubsystem> AsyncWidgetLoader = nullptr;
+
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UUserWidget>, FStrategyEntryPoolBucket> Buckets;
+
+	int32 NumPooledWidgets = 0;
+
+	/** Whether widgets were trimmed into the loader's pools since the last ReleaseTrimmedWidgets. */
+	bool bHasTrimmedWidgets = false;
+
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle MemoryTrimHandle;
+	FTSTicker::FDelegateHandle IdleTrimTickerHandle;
+};
@@ -7,6 +7,9 @@
 #if WITH_GAMEPLAY_DEBUGGER
 #include <GameplayDebuggerCategory.h>
 #include <GameplayDebuggerAddonBase.h>
+#include <UObject/ObjectKey.h>
+
+class FScriptMapHelper;
 
 /**
  * Local-only debug category for StrategyUI which reflects properties of a UObject.
@@ -59,6 +62,39 @@ public:
 	static TSharedPtr<FReflectedObjectsDebugCategory> ActiveInstance;
 
 private:
+	/** A property category of a class, its properties sorted by display name. */
+	struct FCategoryLayout
+	{
+		FString Header;
+		TArray<FProperty*> Properties;
+		TArray<FString> DisplayNames;
+	};
+
+	/** How a class' properties are shown under the current category filters, built once per class. */
+	struct FClassLayout
+	{
+		TWeakObjectPtr<const UClass> Class;
+		TArray<FCategoryLayout> Categories;
+	};
+
+	/** The lines last formatted for one property of one target, and the exported text of the value they were formatted from. */
+	struct FPropertyRowCache
+	{
+		explicit FPropertyRowCache(const FProperty* InProperty) : Property(InProperty) {}
+
+		/** Whether ValuePtr still exports to the text Lines were formatted from, snapshotting it if not. */
+		bool SnapshotValue(const void* ValuePtr);
+
+		const FProperty* Property = nullptr;
+
+		FString ValueSnapshot;
+		bool bHasSnapshot = false;
+
+		// One line, or for TMaps the summary then one line per entry; only lines on a shown page get formatted
+		TArray<FString> Lines;
+		TBitArray<> FormattedLines;
+	};
+
 	/** The objects we want to inspect. */
 	TArray<TWeakObjectPtr<UObject>> TargetObjects;
 
@@ -66,9 +102,12 @@ private:
 	 */
 	TArray<FString> PropertyCategoryFilters;
 	
-	/** Cached debug text lines for pagination */
+	/** Debug text lines of the current page */
 	TArray<FString> CachedLines;
 
+	/** Lines across all pages, as of the last collect. */
+	int32 TotalLines = 0;
+
 	/** Current page index for large reflected data sets. */
 	int32 CurrentPage = 0;
 
@@ -81,11 +120,47 @@ private:
 	/** Affects line height, tweak this to improve pagination fit. */
 	float CharHeight = 30.f;
 
-	void ReflectTArrayProperty(const FArrayProperty* ArrayProp, UObject* Obj, const FString& DisplayName);
-	/** Helper method: reflect a single UObject, printing lines via AddTextLine(). */
+	/** Per-class property grouping, rebuilt only when the filters change. */
+	TMap<FObjectKey, FClassLayout> ClassLayouts;
+
+	/** Per-target, per-property formatted lines. */
+	TMap<TPair<FObjectKey, const FProperty*>, TUniquePtr<FPropertyRowCache>> RowCaches;
+
+	// Page window of the collect in progress: [PageStartLine, PageEndLine)
+	int32 PageStartLine = 0;
+	int32 PageEndLine = 0;
+	int32 CollectLineIndex = 0;
+
+	/** Counts a line of the collect in progress, only formatting it (through MakeLine) if it's on the current page. */
+	template<typename FMakeLine>
+	void EmitLine(FMakeLine&& MakeLine)
+	{
+		if (CollectLineIndex >= PageStartLine && CollectLineIndex < PageEndLine)
+		{
+			CachedLines.Add(MakeLine());
+		}
+		++CollectLineIndex;
+	}
+
+	/** The (cached) layout of Class under the current filters. */
+	const FClassLayout& GetClassLayout(const UClass* Class);
+
+	/** Drops the cached lines of objects that are no longer targets. */
+	void PruneRowCaches();
+
+	/** Emits the lines of Obj's properties, formatting only the visible ones that changed since the last collect. */
 	void ReflectObjectProperties(UObject* Obj);
 
-	/** Reflect a TMap property (with TMap key/value) in detail. */
-	void ReflectTMapProperty(const FMapProperty* MapProp, UObject* Obj, const FString& DisplayName);
+	/** Emits the lines of one property of Obj. */
+	void ReflectProperty(UObject* Obj, FProperty* Property, const FString& DisplayName);
+
+	/** Formats a non-map property value as a debug line. */
+	static FString FormatPropertyLine(const FProperty* Property, const FString& DisplayName, const void* ValuePtr, const UObject* Obj);
+
+	/** Formats one (the entry at SparseIndex) of a TMap property's entries as a debug line. */
+	static FString FormatMapEntryLine(const FMapProperty* MapProp, FScriptMapHelper& MapHelper, int32 SparseIndex);
+
+	/** Whether Property's value has state reflection can't compare (so it's re-formatted whenever it's shown). */
+	static bool HasUnreflectedState(const FProperty* Property);
 };
 #endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,49 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameplayTagContainer.h>
+
+#include "StrategyEntryState.generated.h"
+
+/**
+ * Compact form of the built-in StrategyUI.EntryLifecycle.* and StrategyUI.EntryInteraction.* tags.
+ * Entry slots keep their state as this mask; tag containers are only built when handing state to Blueprint.
+ */
+UENUM(BlueprintType, meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true"))
+enum class EStrategyEntryState : uint8
+{
+	None        = 0 UMETA(Hidden),
+
+	// Lifecycle (mutually exclusive)
+	Loading     = 1 << 0,
+	Pooled      = 1 << 1,
+	Deactivated = 1 << 2,
+	Active      = 1 << 3,
+
+	// Interaction (additive)
+	Focused     = 1 << 4,
+	Selected    = 1 << 5,
+};
+ENUM_CLASS_FLAGS(EStrategyEntryState);
+
+namespace StrategyEntryState
+{
+	inline constexpr EStrategyEntryState LifecycleMask =
+		EStrategyEntryState::Loading | EStrategyEntryState::Pooled | EStrategyEntryState::Deactivated | EStrategyEntryState::Active;
+
+	inline constexpr EStrategyEntryState InteractionMask = EStrategyEntryState::Focused | EStrategyEntryState::Selected;
+
+	/** Replaces the lifecycle bits of InState with NewLifecycle, keeping the interaction bits. */
+	inline EStrategyEntryState WithLifecycle(const EStrategyEntryState InState, const EStrategyEntryState NewLifecycle)
+	{
+		return (InState & ~LifecycleMask) | (NewLifecycle & LifecycleMask);
+	}
+
+	/** Returns the state flag for one of the built-in entry tags, or None if Tag isn't one of them. */
+	STRATEGYUI_API EStrategyEntryState FromTag(const FGameplayTag& Tag);
+
+	/** Returns the tag container matching State. Containers are built once per distinct mask and cached. */
+	STRATEGYUI_API const FGameplayTagContainer& ToTagContainer(EStrategyEntryState State);
+}
@@ -0,0 +1,82 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Stats/Stats.h>
+#include <Trace/Trace.h>
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+
+#include "StrategyUIStats.generated.h"
+
+/*
+ * `stat StrategyUI` shows these for every strategy widget combined, plus an "UpdateWidgets [WidgetName]" cycle stat per
+ * widget instance. In Unreal Insights, enable the StrategyUI channel (-trace=default,StrategyUI) for the same scopes.
+ */
+DECLARE_STATS_GROUP(TEXT("StrategyUI"), STATGROUP_StrategyUI, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateWidgets"), STAT_StrategyUI_UpdateWidgets, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RebuildSlateForIndices"), STAT_StrategyUI_RebuildSlateForIndices, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateChildrenData"), STAT_StrategyUI_UpdateChildrenData, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Canvas ArrangeChildren"), STAT_StrategyUI_CanvasArrangeChildren, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Canvas Paint"), STAT_StrategyUI_CanvasPaint, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AcquireEntryWidget"), STAT_StrategyUI_AcquireEntryWidget, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ReleaseEntryWidget"), STAT_StrategyUI_ReleaseEntryWidget, STATGROUP_StrategyUI, STRATEGYUI_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Entry Acquires"), STAT_StrategyUI_EntryAcquires, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Entry Releases"), STAT_StrategyUI_EntryReleases, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Entry Pool Hits"), STAT_StrategyUI_EntryPoolHits, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Blueprint Dispatches"), STAT_StrategyUI_BlueprintDispatches, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Loads Completed"), STAT_StrategyUI_AsyncLoadsCompleted, STATGROUP_StrategyUI, STRATEGYUI_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Async Load Latency (ms, summed)"), STAT_StrategyUI_AsyncLoadLatency, STATGROUP_StrategyUI, STRATEGYUI_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Slots"), STAT_StrategyUI_LiveSlots, STATGROUP_StrategyUI, STRATEGYUI_API);
+
+/** Insights trace channel for StrategyUI's hot paths, off by default. */
+UE_TRACE_CHANNEL_EXTERN(StrategyUIChannel, STRATEGYUI_API);
+
+/** A CPU profiler scope on the StrategyUI trace channel. */
+#define STRATEGYUI_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, StrategyUIChannel)
+
+/**
+ * What one strategy widget did in a frame, kept in every build configuration (unlike stats) so a spike can be
+ * attributed to a menu instance even in shipping.
+ */
+USTRUCT(BlueprintType)
+struct STRATEGYUI_API FStrategyWidgetFrameStats
+{
+	GENERATED_BODY()
+
+	/** GFrameCounter of the frame these stats are for. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int64 FrameNumber = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumAcquires = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumReleases = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumPoolHits = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumBlueprintDispatches = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumAsyncLoadsCompleted = 0;
+
+	/** Longest request-to-loaded time of the async loads completed this frame. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats", meta=(Units="ms"))
+	float MaxAsyncLoadLatencyMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats", meta=(Units="ms"))
+	float UpdateWidgetsMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats", meta=(Units="ms"))
+	float RebuildSlateMs = 0.f;
+
+	/** Live slots at the end of the frame's last UpdateWidgets. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Stats")
+	int32 NumLiveSlots = 0;
+};
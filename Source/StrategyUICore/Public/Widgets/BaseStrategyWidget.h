@@ -4,19 +4,25 @@
 
 #include <CoreMinimal.h>
 #include <Blueprint/UserWidgetPool.h>
+#include <Containers/Ticker.h>
 #include <GameplayTagContainer.h>
 
 #include <Interfaces/IAsyncWidgetRequestHandler.h>
 
 #include "Interfaces/ILayoutStrategyHost.h"
+#include "Interfaces/IStrategyDataProvider.h"
+#include "Utils/StrategyEntryState.h"
+#include "Utils/StrategyUIStats.h"
+#include "Widgets/SStrategyCanvasPanel.h"
+#include "Widgets/StrategyEntryWidgetBase.h"
 
 #include "BaseStrategyWidget.generated.h"
 
 class UAsyncWidgetLoaderSubsystem;
+class UStrategyEntryPoolSubsystem;
 class UBaseLayoutStrategy;
 class UUserWidget;
-class IStrategyDataProvider;
-class SStrategyCanvasPanel;
+struct FStreamableHandle;
 
 USTRUCT()
 struct FStrategyEntrySlotData
@@ -31,11 +37,20 @@ public:
 	virtual FStrategyEntrySlotData& operator=(const FStrategyEntrySlotData& Other)
 	{
 		Widget = Other.Widget;
-		TagState = Other.TagState;
+		CachedSlateWidget = Other.CachedSlateWidget;
+		EntryState = Other.EntryState;
+		NotifiedEntryState = Other.NotifiedEntryState;
+		bEntryStateDirty = Other.bEntryStateDirty;
 		Position = Other.Position;
 		Depth = Other.Depth;
 		LastAssignedItem = Other.LastAssignedItem;
+		ItemAssignedWidget = Other.ItemAssignedWidget;
+		EntryDispatchWidget = Other.EntryDispatchWidget;
+		EntryDispatch = Other.EntryDispatch;
+		DataIndex = Other.DataIndex;
+		PanelSlotHandle = Other.PanelSlotHandle;
 		bIsPlaceholder = Other.bIsPlaceholder;
+		bConstructionDeferred = Other.bConstructionDeferred;
 		return *this;
 	}
 	
@@ -44,9 +59,17 @@ public:
 	TWeakObjectPtr<UUserWidget> Widget = nullptr;
 	TSharedPtr<SWidget> CachedSlateWidget = nullptr;
 
-	// The current tag state (lifecycle, interaction, etc.)
-	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
-	FGameplayTagContainer TagState;
+	// The current lifecycle/interaction state
+	EStrategyEntryState EntryState = EStrategyEntryState::None;
+
+	// The state the entry widget was last notified of (lags EntryState while a coalesced notification is pending)
+	EStrategyEntryState NotifiedEntryState = EStrategyEntryState::None;
+
+	// Whether this slot is queued for the next coalesced state notification flush
+	bool bEntryStateDirty = false;
+
+	/** The current state as gameplay tags (StrategyUI.EntryLifecycle.*, StrategyUI.EntryInteraction.*). */
+	const FGameplayTagContainer& GetTagState() const { return StrategyEntryState::ToTagContainer(EntryState); }
 
 	// The latest position computed by the layout strategy's GetItemPosition()
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
@@ -60,18 +83,39 @@ public:
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
 	bool bIsPlaceholder = false;
 
+	// Whether the entry widget is still to be built by progressive construction (see bProgressiveConstruction)
+	bool bConstructionDeferred = false;
+
 	// The last assigned data item, for detecting changes
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
 	TWeakObjectPtr<UObject> LastAssignedItem = nullptr;
 
+	// The widget that LastAssignedItem was last pushed to via BP_OnStrategyEntryItemAssigned
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
+	TWeakObjectPtr<UUserWidget> ItemAssignedWidget = nullptr;
+
+	// The widget EntryDispatch was resolved for
+	TWeakObjectPtr<UUserWidget> EntryDispatchWidget = nullptr;
+
+	// How EntryDispatchWidget gets IStrategyEntryBase events (see UBaseStrategyWidget::GetEntryDispatch)
+	EStrategyEntryDispatch EntryDispatch = EStrategyEntryDispatch::Unresolved;
+
+	// The data index this global index maps to, as of the last acquire (INDEX_NONE for gap entries)
+	UPROPERTY(Transient, VisibleInstanceOnly, Category = "StrategyUI|BaseStrategyWidget")
+	int32 DataIndex = INDEX_NONE;
+
+	// The child slot showing CachedSlateWidget in the SStrategyCanvasPanel (unset while not in the panel)
+	FStrategyCanvasSlotHandle PanelSlotHandle;
+
 	virtual FString ToString() const
 	{
-		return FString::Printf(TEXT("\n\t\tWidget: %s, \n\t\tTagState: %s, \n\t\tPosition: %s, \n\t\tDepth: %f, \n\t\tLastItem: %s, \n\t\tPlaceholder: %s"),
+		return FString::Printf(TEXT("\n\t\tWidget: %s, \n\t\tTagState: %s, \n\t\tPosition: %s, \n\t\tDepth: %f, \n\t\tLastItem: %s, \n\t\tDataIndex: %d, \n\t\tPlaceholder: %s"),
 			Widget.IsValid() ? *Widget->GetName() : TEXT("None"),
-			*TagState.ToString(),
+			*GetTagState().ToString(),
 			*Position.ToString(),
 			Depth,
 			LastAssignedItem.IsValid() ? *LastAssignedItem->GetName() : TEXT("None"),
+			DataIndex,
 			bIsPlaceholder ? TEXT("True") : TEXT("False"));
 	}
 
@@ -79,26 +123,35 @@ public:
 	{
 		Widget.Reset();
 		CachedSlateWidget.Reset();
-		TagState.Reset();
+		EntryState = EStrategyEntryState::None;
+		NotifiedEntryState = EStrategyEntryState::None;
+		bEntryStateDirty = false;
 		Position = FVector2D::ZeroVector;
 		Depth = 0.f;
 		LastAssignedItem.Reset();
+		ItemAssignedWidget.Reset();
+		EntryDispatchWidget.Reset();
+		EntryDispatch = EStrategyEntryDispatch::Unresolved;
+		DataIndex = INDEX_NONE;
+		PanelSlotHandle.Reset();
 		bIsPlaceholder = false;
+		bConstructionDeferred = false;
 	}
 
 	virtual bool operator==(const FStrategyEntrySlotData& Other) const
 	{
 		return Widget == Other.Widget
-			&& TagState == Other.TagState
+			&& EntryState == Other.EntryState
 			&& Position == Other.Position
 			&& FMath::IsNearlyEqual(Depth, Other.Depth)
 			&& LastAssignedItem == Other.LastAssignedItem
+			&& DataIndex == Other.DataIndex
 			&& bIsPlaceholder == Other.bIsPlaceholder;
 	}
 
 	virtual bool IsValid() const
 	{
-		return Widget.IsValid() && TagState.IsValid() && CachedSlateWidget.IsValid();
+		return Widget.IsValid() && EntryState != EStrategyEntryState::None && CachedSlateWidget.IsValid();
 	}
 };
 
@@ -111,6 +164,227 @@ struct TBaseStructure<FStrategyEntrySlotData>
 	}
 };
 
+/**
+ * Windowed storage for entry slot data, keyed by global index.
+ *
+ * Every layout strategy desires a contiguous window of global indices (at most MaxVisibleEntries plus the
+ * deactivated margins on both sides), so slots live in a power-of-two ring buffer where a global index maps
+ * straight to its physical slot via (GlobalIndex & Mask), i.e. its offset from the window head wrapped to the
+ * capacity. As the window slides, the entering index lands in the slot the leaving index just freed.
+ *
+ * Two live global indices can only collide if the live span exceeds the capacity, in which case the ring grows.
+ */
+USTRUCT()
+struct STRATEGYUI_API FStrategyEntrySlotWindow
+{
+	GENERATED_BODY()
+
+public:
+	/** Ensures the ring can hold a contiguous window of at least InCapacity global indices without growing. */
+	void Reserve(int32 InCapacity);
+
+	/** Releases all slots (the ring keeps its capacity). */
+	void Empty();
+
+	/** Number of live slots. */
+	int32 Num() const { return NumLiveSlots; }
+
+	/** Number of physical slots in the ring. */
+	int32 GetCapacity() const { return Slots.Num(); }
+
+	bool Contains(const int32 GlobalIndex) const { return Find(GlobalIndex) != nullptr; }
+
+	FStrategyEntrySlotData* Find(const int32 GlobalIndex)
+	{
+		const int32 SlotIndex = ToSlotIndex(GlobalIndex);
+		return (SlotIndex != INDEX_NONE && OccupiedSlots[SlotIndex] && SlotGlobalIndices[SlotIndex] == GlobalIndex)
+			? &Slots[SlotIndex]
+			: nullptr;
+	}
+
+	const FStrategyEntrySlotData* Find(const int32 GlobalIndex) const
+	{
+		return const_cast<FStrategyEntrySlotWindow*>(this)->Find(GlobalIndex);
+	}
+
+	FStrategyEntrySlotData& FindChecked(const int32 GlobalIndex)
+	{
+		FStrategyEntrySlotData* SlotData = Find(GlobalIndex);
+		check(SlotData);
+		return *SlotData;
+	}
+
+	const FStrategyEntrySlotData& FindChecked(const int32 GlobalIndex) const
+	{
+		const FStrategyEntrySlotData* SlotData = Find(GlobalIndex);
+		check(SlotData);
+		return *SlotData;
+	}
+
+	/**
+	 * Returns the slot for GlobalIndex, claiming a fresh one if it isn't live yet.
+	 * Claiming a slot may grow the ring, which invalidates previously returned references.
+	 */
+	FStrategyEntrySlotData& FindOrAdd(int32 GlobalIndex);
+
+	/** Resets and frees the slot for GlobalIndex. Returns false if it wasn't live. */
+	bool Remove(int32 GlobalIndex);
+
+	/** Outputs the global indices of all live slots (in ring order, not sorted). Takes any allocator so callers can use stack scratch. */
+	template<typename AllocatorType>
+	void GenerateKeyArray(TArray<int32, AllocatorType>& OutGlobalIndices) const
+	{
+		OutGlobalIndices.Reset(NumLiveSlots);
+		for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+		{
+			OutGlobalIndices.Add(SlotGlobalIndices[It.GetIndex()]);
+		}
+	}
+
+	/**
+	 * Calls Func(GlobalIndex, SlotData) for each live slot.
+	 * Func must not add or remove slots.
+	 */
+	template<typename FuncType>
+	void ForEachSlot(FuncType Func)
+	{
+		for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+		{
+			const int32 SlotIndex = It.GetIndex();
+			Func(SlotGlobalIndices[SlotIndex], Slots[SlotIndex]);
+		}
+	}
+
+	template<typename FuncType>
+	void ForEachSlot(FuncType Func) const
+	{
+		for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+		{
+			const int32 SlotIndex = It.GetIndex();
+			Func(SlotGlobalIndices[SlotIndex], Slots[SlotIndex]);
+		}
+	}
+
+	FString ToString() const;
+
+private:
+	/** Minimum ring capacity, so small wheels don't repeatedly grow while filling up. */
+	static constexpr int32 MinCapacity = 16;
+
+	int32 ToSlotIndex(const int32 GlobalIndex) const
+	{
+		// Capacity is always a power of two, so masking is a proper modulo for negative indices as well
+		return Slots.Num() > 0 ? (GlobalIndex & (Slots.Num() - 1)) : INDEX_NONE;
+	}
+
+	/** Grows the ring until all live slots plus InGlobalIndex fit without colliding. */
+	void GrowToFit(int32 InGlobalIndex);
+
+	/** The slot data, indexed by physical slot. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget")
+	TArray<FStrategyEntrySlotData> Slots;
+
+	/** Global index currently held by each physical slot. Only meaningful where OccupiedSlots is set. */
+	TArray<int32> SlotGlobalIndices;
+
+	/** Which physical slots are live. */
+	TBitArray<> OccupiedSlots;
+
+	int32 NumLiveSlots = 0;
+};
+
+template<>
+struct TBaseStructure<FStrategyEntrySlotWindow>
+{
+	static const UScriptStruct* Get()
+	{
+		return FStrategyEntrySlotWindow::StaticStruct();
+	}
+};
+
+/**
+ * Tracks pending async widget requests in both directions, so loader callbacks (which only know the RequestId)
+ * and slot releases (which only know the GlobalIndex) can both resolve their counterpart without a scan.
+ */
+USTRUCT()
+struct STRATEGYUI_API FStrategyAsyncRequestTable
+{
+	GENERATED_BODY()
+
+public:
+	/** Tracks RequestId for GlobalIndex. RequestTime (FPlatformTime::Seconds) defaults to now, re-issued requests pass the original one. */
+	void Add(const int32 GlobalIndex, const int32 RequestId, const float Priority = 1.f, const double RequestTime = -1.0)
+	{
+		RemoveByGlobalIndex(GlobalIndex);
+		GlobalIndexToRequestId.Add(GlobalIndex, RequestId);
+		RequestIdToGlobalIndex.Add(RequestId, GlobalIndex);
+		GlobalIndexToPriority.Add(GlobalIndex, Priority);
+		GlobalIndexToRequestTime.Add(GlobalIndex, RequestTime < 0.0 ? FPlatformTime::Seconds() : RequestTime);
+	}
+
+	bool ContainsGlobalIndex(const int32 GlobalIndex) const { return GlobalIndexToRequestId.Contains(GlobalIndex); }
+
+	const int32* FindRequestId(const int32 GlobalIndex) const { return GlobalIndexToRequestId.Find(GlobalIndex); }
+
+	const int32* FindGlobalIndex(const int32 RequestId) const { return RequestIdToGlobalIndex.Find(RequestId); }
+
+	/** The priority the request for GlobalIndex was made with (0 if there is none). */
+	float FindPriority(const int32 GlobalIndex) const { return GlobalIndexToPriority.FindRef(GlobalIndex); }
+
+	/** When the request for GlobalIndex was first made (FPlatformTime::Seconds, 0 if there is none). */
+	double FindRequestTime(const int32 GlobalIndex) const { return GlobalIndexToRequestTime.FindRef(GlobalIndex); }
+
+	/** Forgets the request pending for GlobalIndex (if any). */
+	void RemoveByGlobalIndex(const int32 GlobalIndex)
+	{
+		int32 RequestId = INDEX_NONE;
+		if (GlobalIndexToRequestId.RemoveAndCopyValue(GlobalIndex, RequestId))
+		{
+			RequestIdToGlobalIndex.Remove(RequestId);
+			GlobalIndexToPriority.Remove(GlobalIndex);
+			GlobalIndexToRequestTime.Remove(GlobalIndex);
+		}
+	}
+
+	/** Forgets RequestId, outputting the global index it was made for. Returns false for unknown requests. */
+	bool RemoveByRequestId(const int32 RequestId, int32& OutGlobalIndex)
+	{
+		if (RequestIdToGlobalIndex.RemoveAndCopyValue(RequestId, OutGlobalIndex))
+		{
+			GlobalIndexToRequestId.Remove(OutGlobalIndex);
+			GlobalIndexToPriority.Remove(OutGlobalIndex);
+			GlobalIndexToRequestTime.Remove(OutGlobalIndex);
+			return true;
+		}
+		return false;
+	}
+
+	void Empty()
+	{
+		GlobalIndexToRequestId.Empty();
+		RequestIdToGlobalIndex.Empty();
+		GlobalIndexToPriority.Empty();
+		GlobalIndexToRequestTime.Empty();
+	}
+
+	int32 Num() const { return GlobalIndexToRequestId.Num(); }
+
+	/** GlobalIndex -> RequestId for every pending request. */
+	const TMap<int32, int32>& GetRequests() const { return GlobalIndexToRequestId; }
+
+private:
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
+	TMap<int32, int32> GlobalIndexToRequestId;
+
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
+	TMap<int32, int32> RequestIdToGlobalIndex;
+
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
+	TMap<int32, float> GlobalIndexToPriority;
+
+	TMap<int32, double> GlobalIndexToRequestTime;
+};
+
 /**
  * Delegate broadcast when an item gains focus.o
  * Provides the index and the data item object implementing UStrategyInteractiveEntry.
@@ -202,9 +476,81 @@ public:
 	/** Toggles selection state of the currently focused data index. */
 	UFUNCTION(BlueprintCallable, Category="StrategyUI|BaseStrategyWidget|Selection")
 	virtual void ToggleFocusedIndexSelection();
+
+	/** Returns whether the item at DataIndex is currently selected. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|Selection")
+	bool IsDataIndexSelected(const int32 DataIndex) const
+	{
+		return SelectedDataIndices.IsValidIndex(DataIndex) && SelectedDataIndices[DataIndex];
+	}
+
+	/** Returns all currently selected data indices, in ascending order. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|Selection")
+	TArray<int32> GetSelectedDataIndices() const;
+
+	/**
+	 * Pre-instantiates pooled widgets for DefaultEntryWidgetClass, DefaultLoadingPlaceholderClass and (per the project
+	 * settings) the tag-mapped classes, so the first UpdateWidgets doesn't create every entry in a single frame.
+	 * Creation is spread over frames on the core ticker, so it keeps going during loading screens. Soft classes are
+	 * loaded first. Replaces any warm-up in progress.
+	 *
+	 * @param NumPerClass    Widgets to create per class. 0 or less uses UStrategyUIProjectSettings::WarmUpWidgetsPerClass.
+	 * @param FrameBudgetMs  Time to spend per frame. 0 or less uses UStrategyUIProjectSettings::WarmUpFrameBudgetMs.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|BaseStrategyWidget|PoolWarmUp")
+	void WarmUpEntryWidgetPools(int32 NumPerClass = 0, float FrameBudgetMs = 0.f);
+
+	/** Stops a warm-up in progress. Widgets it already created stay pooled. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|BaseStrategyWidget|PoolWarmUp")
+	void CancelEntryWidgetPoolWarmUp();
+
+	/** Whether a warm-up started by WarmUpEntryWidgetPools is still running. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|PoolWarmUp")
+	bool IsWarmingUpEntryWidgetPools() const { return WarmUpTickerHandle.IsValid(); }
+
+	/** Whether progressive construction (see bProgressiveConstruction) still has entries to build. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|ProgressiveConstruction")
+	bool IsConstructingProgressively() const { return bIsConstructingProgressively; }
+
+	/**
+	 * Returns the global index of the laid out entry under ScreenPosition (in absolute/screen space, like mouse events),
+	 * i.e. the closest one within EntryPickRadius, or INDEX_NONE. Goes through the layout strategy's spatial index
+	 * instead of Slate's hit-test over every entry.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|BaseStrategyWidget|Picking")
+	int32 PickGlobalIndexAtScreenPosition(const FVector2D& ScreenPosition) const;
+
+	/** What this widget did in the most recent frame it did any work in (see FrameNumber). Available in every build configuration. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|Stats")
+	const FStrategyWidgetFrameStats& GetLastFrameStats() const { return FrameStats; }
 #pragma endregion
 
+#pragma region UBaseStrategyWidget Functions - API Hibernation
+	/** Whether the widget was destructed with bHibernateOnDestruct and is keeping its state for the next construct. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|BaseStrategyWidget|Hibernation")
+	bool IsHibernating() const { return bIsHibernating; }
+
+	/**
+	 * Resets a hibernating widget, giving its entries back to the pools. Does nothing if it isn't hibernating.
+	 * Call it when dropping a hibernating widget for good; it also runs when the widget's world is cleaned up.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|BaseStrategyWidget|Hibernation")
+	void DiscardHibernatedState();
+
 protected:
+	/** Called by NativeDestruct with bHibernateOnDestruct, instead of Reset. */
+	virtual void Hibernate();
+
+	/** Called by NativeConstruct while hibernating, instead of the first-time setup. Applies queued provider updates. */
+	virtual void WakeFromHibernation();
+
+	/** Discards the hibernated state when the world this widget hibernates in goes away. */
+	void OnHibernatingWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	/** Stops listening for the cleanup of the world we hibernate in. */
+	void StopWatchingHibernatingWorld();
+#pragma endregion
+
 #pragma region UBaseStrategyWidget Properties - Editable
 	/** 
 	 * Strategy object used for laying out items according to abstract rules.
@@ -227,6 +573,51 @@ protected:
 	// Whether to show loading placeholders while widgets load asynchronously
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|AsyncLoading")
 	bool bShowLoadingPlaceholders = true;
+
+	/**
+	 * If true, entry loads are prioritized by distance to the focused entry (see ComputeEntryLoadPriority), and loads
+	 * still in flight are re-prioritized as focus moves, so the entry about to be focused doesn't wait behind the far edge.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|AsyncLoading")
+	bool bPrioritizeEntryLoadsByFocus = true;
+
+	/** How quickly load priority drops with distance to focus: Priority = 1 / (1 + Falloff * Distance). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|AsyncLoading", meta=(ClampMin="0.0", EditCondition="bPrioritizeEntryLoadsByFocus"))
+	float EntryLoadPriorityFalloff = 0.5f;
+
+	/**
+	 * An in-flight load is only re-issued when its priority changed by at least this much.
+	 * Re-prioritizing cancels and re-requests the load, so keep this high enough to avoid churn.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|AsyncLoading", meta=(ClampMin="0.0", EditCondition="bPrioritizeEntryLoadsByFocus"))
+	float EntryLoadReprioritizeThreshold = 0.15f;
+
+	/**
+	 * If true, construction only builds the focused entry and its neighbours (see ProgressiveConstructionRadius)
+	 * right away; the rest of the window shows DefaultLoadingPlaceholderClass and is built outwards from focus over
+	 * the following frames, ProgressiveConstructionFrameBudgetMs at a time. Lets a widget with many heavy entries
+	 * open in the frame it's added.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|ProgressiveConstruction")
+	bool bProgressiveConstruction = false;
+
+	/** Entries within this distance of the focused one are built in the construction frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|ProgressiveConstruction", meta=(ClampMin="0", EditCondition="bProgressiveConstruction"))
+	int32 ProgressiveConstructionRadius = 1;
+
+	/** Time progressive construction may spend building entries each frame. At least one entry is built per frame regardless. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|ProgressiveConstruction", meta=(ClampMin="0.1", Units="ms", EditCondition="bProgressiveConstruction"))
+	float ProgressiveConstructionFrameBudgetMs = 2.f;
+
+	/**
+	 * If true, NativeDestruct hibernates instead of resetting: slots, acquired entry widgets, focus, selection and the
+	 * data provider binding are kept while the widget is out of the viewport, so adding it back rebuilds nothing.
+	 * Provider updates received meanwhile are queued and applied as one delta on the next construct.
+	 * A hibernating widget keeps its entries out of the shared pool until DiscardHibernatedState (or Reset), which also
+	 * runs when its world is cleaned up. Progressive construction pauses while hibernating and resumes on wake.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Hibernation")
+	bool bHibernateOnDestruct = false;
 	
 	/**
 	 * Optional data provider. If set, the widget will automatically fetch
@@ -236,14 +627,90 @@ protected:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget", meta=(MustImplement="StrategyDataProvider"))
 	TSubclassOf<UObject> DefaultDataProviderClass = nullptr;
+
+	/**
+	 * If true, entry state notifications (BP_OnStrategyEntryStateTagsChanged, focus/selection changes) are deferred and
+	 * delivered at most once per entry per frame, with the net old/new state.
+	 * e.g. an entry going Pooled -> Active -> Focused in one update gets a single event instead of three.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget")
+	bool bCoalesceEntryStateNotifications = false;
+
+	/**
+	 * If true, entries stay anchored in the panel and layout positions are applied as render transforms on their Slate widgets.
+	 * Moving entries (e.g. spinning a radial menu) then never re-arranges or repaints the panel, so it plays well with
+	 * SInvalidationPanel / global invalidation.
+	 *
+	 * Note: the render transform of each entry widget's root is owned by this widget while the mode is on.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget")
+	bool bUseRenderTransformMovement = false;
+
+	/**
+	 * If true, entries far from focus (see FullWidgetFocusDistance) or deactivated are drawn by the panel as lightweight
+	 * proxies (EntryProxyBrush) instead of getting a real entry widget.
+	 *
+	 * This also lets the layout strategy's window grow past MAX_ENTRY_COUNT (up to MAX_WINDOW_ENTRY_COUNT): only the
+	 * MAX_ENTRY_COUNT entries closest to focus then get real widgets, any others are proxies.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies")
+	bool bUseEntryProxies = false;
+
+	/** Entries more than this many steps from the focused entry are drawn as proxies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies", meta=(ClampMin="0", EditCondition="bUseEntryProxies"))
+	int32 FullWidgetFocusDistance = 4;
+
+	/** If true, entries outside the visible window (the deactivated margin) are always drawn as proxies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies", meta=(EditCondition="bUseEntryProxies"))
+	bool bProxyDeactivatedEntries = true;
+
+	/** Brush drawn for each proxy entry. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies")
+	FSlateBrush EntryProxyBrush;
+
+	/** Size each proxy entry is drawn at. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies")
+	FVector2D EntryProxySize = FVector2D(32.f, 32.f);
+
+	/** Tint applied to the proxy of a selected entry. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Proxies")
+	FLinearColor EntryProxySelectedTint = FLinearColor(1.f, 0.85f, 0.4f, 1.f);
+
+	/** How far from an entry's center (in local units) PickGlobalIndexAtScreenPosition still picks it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Picking", meta=(ClampMin="0.0"))
+	float EntryPickRadius = 48.f;
+
+	/**
+	 * If true, entries the layout is about to scroll through (e.g. during an animated scroll) get their widget classes
+	 * loaded and their pools warmed ahead of time, so they don't pop in as placeholders mid-scroll.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Prefetch")
+	bool bPrefetchEntryWidgets = true;
+
+	/** Most global indices a single prefetch looks at; the ones reached first win. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Prefetch", meta=(ClampMin="0", EditCondition="bPrefetchEntryWidgets"))
+	int32 MaxPrefetchedEntries = 32;
+
+	/** Most widgets a single prefetch instantiates into the pool of each entry widget class. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|Prefetch", meta=(ClampMin="0", EditCondition="bPrefetchEntryWidgets"))
+	int32 MaxPrefetchedWidgetsPerClass = 4;
+
+	/**
+	 * With a paged data provider (IStrategyPagedDataProvider), the most item pages kept in Items at once.
+	 * Pages the visible window maps to are always kept, the least recently used others are released first.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|BaseStrategyWidget|DataProvider", meta=(ClampMin="1"))
+	int32 MaxResidentItemPages = 8;
 #pragma endregion
 
 #pragma region UUserWidget & UWidget Overrides
+	virtual void NativeOnInitialized() override;
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 	virtual void SynchronizeProperties() override;
+	virtual void BeginDestroy() override;
 	virtual int32 NativePaint(
 		const FPaintArgs& Args,
 		const FGeometry& AllottedGeometry,
@@ -257,6 +724,7 @@ protected:
 
 #pragma region ILayoutStrategyHost Interface
 	virtual int32 GetNumItems_Implementation() const override { return GetItemCount(); }
+	virtual bool UsesEntryProxies_Implementation() const override { return bUseEntryProxies; }
 #pragma endregion
 
 #pragma region IAsyncWidgetRequestHandler Interface
@@ -269,11 +737,56 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
 	TObjectPtr<UAsyncWidgetLoaderSubsystem> AsyncWidgetLoader = nullptr;
 
-	// Map to track pending widget load requests (GlobalIndex -> RequestId)
-	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
-	TMap<int32, int32> GlobalIndexToRequestId;
+	// Shared pool our entry widgets go back to once we're done with them
+	UPROPERTY(Transient)
+	TObjectPtr<UStrategyEntryPoolSubsystem> EntryPool = nullptr;
+
+	// Pending widget load requests (GlobalIndex <-> RequestId)
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
+	FStrategyAsyncRequestTable PendingRequests;
+
+	// Global indices whose widgets finished loading since the last batch flush
+	TArray<int32> PendingLoadedGlobalIndices;
+
+	// Next-tick timer that flushes PendingLoadedGlobalIndices as a single batch
+	FTimerHandle LoadBatchFlushTimerHandle;
 
 	void ReplacePlaceholderWithActualWidget(int32 GlobalIndex, UUserWidget* ActualWidget);
+
+	/** Queues GlobalIndex for the next batch flush, scheduling one if needed. */
+	void QueueLoadedEntryForBatch(int32 GlobalIndex);
+
+	/** Hands every queued global index to OnAsyncWidgetLoadBatchCompleted at once. */
+	void FlushLoadedEntryBatch();
+
+	/**
+	 * Load priority for the entry at GlobalIndex, passed to RequestWidget_Async (higher loads first).
+	 * By default 1 at focus, dropping with distance to FocusedGlobalIndex (see EntryLoadPriorityFalloff).
+	 */
+	virtual float ComputeEntryLoadPriority(int32 GlobalIndex) const;
+
+	/**
+	 * Re-issues in-flight loads whose priority moved by at least EntryLoadReprioritizeThreshold since they were
+	 * requested. Only does work when focus changed since the last call.
+	 */
+	virtual void ReprioritizePendingRequests();
+
+	/** Cancels the in-flight loads for GlobalIndices in one pass. Their slots keep whatever placeholder they have. */
+	void CancelPendingRequests(TConstArrayView<int32> GlobalIndices);
+
+	/** Cancels every in-flight load for a global index outside KeepRange, e.g. once the window moved past them. */
+	void CancelPendingRequestsOutside(const FInt32Range& KeepRange);
+
+	/** FocusedGlobalIndex the pending requests were last prioritized for. */
+	int32 LastLoadPriorityFocusIndex = INDEX_NONE;
+
+	/**
+	 * Called once per frame (at most) with every global index whose widget finished loading since the last call.
+	 * By default, rebuilds the Slate panel once for the whole batch.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category="StrategyUI|BaseStrategyWidget|AsyncWidgetLoader")
+	void OnAsyncWidgetLoadBatchCompleted(const TArray<int32>& LoadedGlobalIndices);
+	virtual void OnAsyncWidgetLoadBatchCompleted_Implementation(const TArray<int32>& LoadedGlobalIndices);
 #pragma endregion
 
 #pragma region UBaseStrategyWidget Functions - Entry Widgets Pool & Handling
@@ -286,30 +799,115 @@ protected:
 		return *StrategyType;
 	}
 
-	/** Gets the best entry widget class for the item at GlobalIndex. */
+	/** Gets the best entry widget class for the item at GlobalIndex, falling back to DefaultEntryWidgetClass. */
 	TSoftClassPtr<UUserWidget> ResolveEntryWidgetClass(int32 GlobalIndex);
-	
+
+	/**
+	 * Asks DataItem (an IStrategyEntryWidgetProvider) which class it wants: its hard class, then its soft class, then
+	 * whatever its tag maps to in the project settings. Returns null if none. Results are cached in ResolvedEntryClassCache.
+	 */
+	TSoftClassPtr<UUserWidget> ResolveEntryWidgetClassForItem(const UObject* DataItem) const;
+
+	/**
+	 * Loads the entry widget classes for GlobalIndices and warms their pools, so acquiring those entries later doesn't go
+	 * through a placeholder. Replaces any prefetch still in flight.
+	 * Indices that already have a widget or a pending request are skipped; of the rest, the first MaxPrefetchedEntries win.
+	 */
+	virtual void PrefetchEntryWidgets(TConstArrayView<int32> GlobalIndices);
+
+	/** Drops the prefetch in flight, if any. Already warmed pools are kept. */
+	void CancelEntryWidgetPrefetch();
+
+	/** Instantiates pooled widgets for every prefetched class that is loaded, then forgets them. */
+	void WarmPrefetchedEntryPools();
+
+	/** Looks up the AsyncWidgetLoader and entry pool subsystems and points the loader's creation context at this widget. */
+	void InitializeAsyncWidgetLoader();
+
+	/** Takes a free entry widget of WidgetClass from the shared entry pool, or has the loader create one. For warm-ups, not counted in the pool's hit ratio. */
+	UUserWidget* GetOrCreateEntryWidget(TSubclassOf<UUserWidget> WidgetClass);
+
+	/** Hands an entry widget this widget is done with to the shared entry pool. */
+	void ReleaseEntryWidgetToPool(UUserWidget* Widget);
+
+	/**
+	 * Hands every live entry widget of this widget back to the shared entry pool (placeholders to the loader) and
+	 * forgets their slots. Entries pooled by other strategy widgets are left alone.
+	 */
+	void ReleaseAllEntryWidgets();
+
+	/** Creates warm-up widgets until this frame's budget runs out. Returns false (unregistering itself) once done. */
+	bool TickEntryPoolWarmUp(float DeltaTime);
+
+	/** Hands every widget the warm-up is holding back to its pool. */
+	void ReleaseWarmUpInstances();
+
+	/** Starts deferring entries outside ProgressiveConstructionRadius; TickProgressiveConstruction builds them later. */
+	void BeginProgressiveConstruction();
+
+	/** Builds deferred entries, closest to focus first, until this frame's budget runs out. Returns false once done. */
+	bool TickProgressiveConstruction(float DeltaTime);
+
+	/** Stops progressive construction. Entries still deferred are built normally the next time they're acquired. */
+	void CancelProgressiveConstruction();
+
+	/** Builds the entry widget progressive construction deferred for GlobalIndex. Returns false if there was none. */
+	bool BuildDeferredEntryWidget(int32 GlobalIndex);
+
 	/** Create (or retrieve from a pool) a widget for the item at GlobalIndex. */
 	virtual UUserWidget* AcquireEntryWidget(int32 GlobalIndex);
 
+	/**
+	 * Takes a free DesiredClass entry from the shared pool, or has the loader create one. Returns null if the class
+	 * has to load first, in which case the request is added to PendingRequests (unless it failed).
+	 */
+	UUserWidget* CreateOrRequestEntryWidget(int32 GlobalIndex, const TSoftClassPtr<UUserWidget>& DesiredClass);
+
+	/** Shows DefaultLoadingPlaceholderClass for the slot at GlobalIndex (if bShowLoadingPlaceholders). */
+	void AssignLoadingPlaceholder(int32 GlobalIndex, FStrategyEntrySlotData& SlotData);
+
 	/** Releases an entry widget back to the pool if it's no longer needed. */
 	virtual void ReleaseEntryWidget(int32 GlobalIndex);
 
 	/** Releases widgets not found in DesiredIndices, returning them to the pool. */
 	virtual void ReleaseUndesiredWidgets(const TSet<int32>& DesiredIndices);
 
-	/** Called to (re)build the entry widget for the item at InGlobalIndex. */
+	/** Releases widgets outside of DesiredRange, returning them to the pool. */
+	virtual void ReleaseUndesiredWidgets(const FInt32Range& DesiredRange);
+
+	/**
+	 * Called to (re)build the entry widget for the item at InGlobalIndex.
+	 * Only re-assigns the data item if it, or the widget showing it, changed since the last call.
+	 */
 	virtual void UpdateEntryWidget(int32 InGlobalIndex);
 
+	/** Points the slot at GlobalIndex to NewDataIndex, keeping DataIndexToGlobalIndices in sync. */
+	void SetSlotDataIndex(int32 GlobalIndex, FStrategyEntrySlotData& SlotData, int32 NewDataIndex);
+
+	/** Re-maps every live slot to its data index, e.g. after the item count changed. */
+	void RebuildDataIndexLookup();
+
+	/** How Widget gets IStrategyEntryBase events. Resolved once per widget and cached on SlotData. */
+	static EStrategyEntryDispatch GetEntryDispatch(FStrategyEntrySlotData& SlotData, const UUserWidget* Widget);
+
+	/** Hands Item to Widget: NativeOnStrategyEntryItemAssigned for UStrategyEntryWidgetBase, else BP_OnStrategyEntryItemAssigned. */
+	void DispatchEntryItemAssigned(UUserWidget* Widget, FStrategyEntrySlotData& SlotData, const UObject* Item);
+
 	/**
-	 * Updates the lifecycle tag on a widget entry and notifies if it implements IStrategyEntryBase.
+	 * Sets the state of the entry at GlobalIndex and notifies its widget if it implements IStrategyEntryBase.
+	 * With bCoalesceEntryStateNotifications, the notification is deferred to FlushEntryStateNotifications.
 	 */
-	virtual void NotifyStrategyEntryStateChange(
-		int32 GlobalIndex,
-		UUserWidget* Widget,
-		const FGameplayTagContainer& OldState,
-		const FGameplayTagContainer& NewState
-	);
+	virtual void NotifyStrategyEntryStateChange(int32 GlobalIndex, EStrategyEntryState NewState);
+
+	/**
+	 * Delivers the state change since the last notification to Widget: BP_OnStrategyEntryStateTagsChanged,
+	 * plus BP_OnItemFocusChanged/BP_OnItemSelectionChanged if those bits flipped.
+	 * UStrategyEntryWidgetBase entries get the matching native hooks instead.
+	 */
+	virtual void DispatchEntryStateChange(UUserWidget* Widget, FStrategyEntrySlotData& SlotData);
+
+	/** Delivers one coalesced state notification to every entry whose state changed since the last flush. */
+	virtual void FlushEntryStateNotifications();
 
 	/**
 	 * Handles activating/deactivating pooled entries as dictated by the layout's 
@@ -318,14 +916,21 @@ protected:
 	virtual void TryHandlePooledEntryStateTransition(int32 GlobalIndex);
 
 	/**
-	 * Updates the lifecycle tag state for an entry identified by GlobalIndex.
+	 * Updates the lifecycle state for an entry identified by GlobalIndex.
+	 * NewLifecycleState must be exactly one of the lifecycle flags.
 	 */
-	virtual void UpdateEntryLifecycleTagState(const int32 GlobalIndex, const FGameplayTag& NewStateTag);
+	virtual void UpdateEntryLifecycleState(const int32 GlobalIndex, EStrategyEntryState NewLifecycleState);
 
 	/**
-	 * Enables or disables an interaction tag on the entry identified by GlobalIndex.
+	 * Enables or disables interaction flags on the entry identified by GlobalIndex.
 	 */
-	virtual void UpdateEntryInteractionTagState(
+	virtual void UpdateEntryInteractionState(const int32 GlobalIndex, EStrategyEntryState InteractionState, bool bEnable);
+
+	/** Tag-based wrapper for UpdateEntryLifecycleState. */
+	void UpdateEntryLifecycleTagState(const int32 GlobalIndex, const FGameplayTag& NewStateTag);
+
+	/** Tag-based wrapper for UpdateEntryInteractionState. */
+	void UpdateEntryInteractionTagState(
 		const int32 GlobalIndex,
 		const FGameplayTag& InteractionTag,
 		bool bEnable
@@ -345,12 +950,32 @@ protected:
 	/**
 	 * A single function to build the arrays for our Slate panel
 	 * and optionally re-acquire/update widgets for each global index.
+	 * Only the panel slots that changed are patched; with bUseRenderTransformMovement, moves only touch the entries' render transforms.
 	 *
-	 * @param InIndices           The set of global indices we’re displaying.
+	 * @param InIndices           The global indices we’re displaying.
 	 * @param bForceUpdateWidget  If true, call UpdateEntryWidget(...) (releasing/re-acquiring if needed).
 	 *                            If false, only do minimal position/visibility updates.
 	 */
+	void RebuildSlateForIndices(TConstArrayView<int32> InIndices, bool bForceUpdateWidget);
 	void RebuildSlateForIndices(const TSet<int32>& InIndices, bool bForceUpdateWidget);
+
+	/**
+	 * Lets RebuildSlateForIndices take the positions of the contiguous window GlobalIndexRange from somewhere other than
+	 * the layout strategy, e.g. a pass computed off the game thread. Return false to have the strategy compute them.
+	 */
+	virtual bool GetPrecomputedItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const { return false; }
+
+	/** Applies SlotData.Position as the render transform of its Slate widget (bUseRenderTransformMovement), or clears it. */
+	void ApplyEntryRenderTransform(const FStrategyEntrySlotData& SlotData, bool bClear = false) const;
+
+	/** Whether the entry at GlobalIndex is drawn as a panel proxy rather than getting a real entry widget. */
+	virtual bool ShouldUseEntryProxy(int32 GlobalIndex) const;
+
+	/**
+	 * Fills in the proxy drawn for GlobalIndex. Position is already set.
+	 * Override to e.g. pick a brush or label per item (Items[GlobalIndexToDataIndex(GlobalIndex)]).
+	 */
+	virtual void MakeEntryProxy(int32 GlobalIndex, FStrategyCanvasProxyEntry& OutProxy) const;
 #pragma endregion
 
 #pragma region UBaseStrategyWidget Functions - Internal Implementations
@@ -367,6 +992,50 @@ protected:
 	/** Bound to the data provider's update event, forces a refresh of items. */
 	UFUNCTION()
 	virtual void OnDataProviderUpdated();
+
+	/**
+	 * Bound to the data provider's delta event, patches Items in place and re-assigns only the affected live entries.
+	 * Pointer angle, focus and pooled widgets are kept. Falls back to RefreshFromProvider if the delta doesn't add up.
+	 */
+	UFUNCTION()
+	virtual void OnDataProviderDelta(const FStrategyDataProviderDelta& Delta);
+
+	/**
+	 * Applies a delta to Items and the selection, returns false (leaving both untouched) if it doesn't fit the current items.
+	 * Adds the items whose live entries need to be re-assigned even though their slot still points at them.
+	 */
+	bool ApplyDataProviderDelta(const FStrategyDataProviderDelta& Delta, TSet<const UObject*>& OutChangedItems);
+
+	/**
+	 * Re-assigns a live entry's item if it changed (or bForceReassign), on the next UpdateEntryWidget.
+	 * Returns true if the entry had to be released instead because its item wants a different entry class.
+	 */
+	bool RefreshEntryItem(const int32 GlobalIndex, const bool bForceReassign);
+
+	/** Bound to the data provider's page event, stores an asynchronously fetched page. */
+	UFUNCTION()
+	virtual void OnDataProviderPageLoaded(int32 PageIndex, const TArray<UObject*>& PageItems);
+
+	/** Whether DataProvider hands out its items by page, see IStrategyPagedDataProvider. */
+	bool IsUsingPagedDataProvider() const { return ItemPageSize > 0; }
+
+	/** Sizes Items from the paged provider's item count, with every item unfetched. */
+	void RefreshFromPagedProvider();
+
+	/** Fetches the pages CurrentDesiredGlobalIndices map to, releases the least recently used others past MaxResidentItemPages. */
+	void RequestItemPagesForWindow();
+
+	/** Marks a page as most recently used, fetching it if needed. Returns whether its items are in Items. */
+	bool RequestItemPage(const int32 PageIndex);
+
+	/** Copies a fetched page into Items. Live entries of the page that now want a different entry class are released. */
+	void StoreItemPage(const int32 PageIndex, const TArray<UObject*>& PageItems);
+
+	/** Drops a resident or pending page and lets the provider know. */
+	void ReleaseItemPage(const int32 PageIndex);
+
+	/** Drops every resident and pending page, letting the provider know if bNotifyProvider. */
+	void ReleaseAllItemPages(const bool bNotifyProvider);
 	
 	/** Creates a default data provider if DefaultDataProviderClass is set and DataProvider is null. */
 	virtual void TryCreateDefaultDataProvider();
@@ -386,11 +1055,27 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|BaseStrategyWidget|DataProvider")
 	TObjectPtr<UObject> DataProvider = nullptr;
 
+	/** Page size of DataProvider if it's an IStrategyPagedDataProvider, 0 otherwise. */
+	int32 ItemPageSize = 0;
+
+	/** Pages of the paged provider whose items are in Items, least recently used first. */
+	TArray<int32, TInlineAllocator<16>> ResidentItemPages;
+
+	/** Pages the paged provider is fetching asynchronously. */
+	TSet<int32> PendingItemPages;
+
 	//----------------------------------------------------------------------------------------------
 	// UBaseStrategyWidget Properties - Entry Widgets & State
 	//----------------------------------------------------------------------------------------------
+	/** Slot data for every live global index, stored in a ring keyed by offset from the window head. */
 	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget")
-	TMap<int32, FStrategyEntrySlotData> GlobalIndexToSlotData;
+	FStrategyEntrySlotWindow GlobalIndexToSlotData;
+
+	/**
+	 * Reverse lookup from a data index to every live global index showing it.
+	 * Layouts that wrap (e.g. spirals) can show several copies of the same item at once.
+	 */
+	TMultiMap<int32, int32> DataIndexToGlobalIndices;
 
 	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget")
 	TMap<TSubclassOf<UUserWidget>, FUserWidgetPool> WidgetPools;
@@ -401,15 +1086,84 @@ protected:
 	 */
 	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget")
 	TSet<int32> LastDesiredIndices;
+
+	/** The desired window from the last UpdateWidgets, if the layout strategy reports one as a range. */
+	FInt32Range LastDesiredRange = FInt32Range::Empty();
+
+	/** The desired global indices from the last UpdateWidgets, in the order they're laid out. */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget")
+	TArray<int32> CurrentDesiredGlobalIndices;
+
+	/** Global indices with a pending coalesced state notification. */
+	TArray<int32> DirtyEntryStateGlobalIndices;
+
+	/** Proxies built by RebuildSlateForIndices, kept around to reuse the allocation */
+	TArray<FStrategyCanvasProxyEntry> EntryProxyScratch;
+
+	/**
+	 * Class each item resolved to in ResolveEntryWidgetClassForItem (null if it has no preference).
+	 * Cleared when the data provider updates; entries for destroyed items are pruned on SetItems.
+	 */
+	TMap<TWeakObjectPtr<const UObject>, TSoftClassPtr<UUserWidget>> ResolvedEntryClassCache;
+
+	/** Entry widget classes of the last prefetch, and how many upcoming entries want each. */
+	TMap<FSoftObjectPath, int32> PrefetchedClassCounts;
+
+	/** Keeps the prefetched classes loading (and loaded) until their pools are warmed. */
+	TSharedPtr<FStreamableHandle> PrefetchLoadHandle;
+
+	/** One entry widget class still being warmed up, and how many more widgets it needs. */
+	struct FEntryPoolWarmUpTask
+	{
+		TSoftClassPtr<UUserWidget> WidgetClass;
+		int32 NumRemaining = 0;
+	};
+	TArray<FEntryPoolWarmUpTask> WarmUpTasks;
+
+	/**
+	 * Widgets created by the warm-up so far. They're held (not pooled) until the warm-up finishes; handing them back
+	 * one at a time would just have the pool return the same free instance for every request.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> WarmUpInstances;
+
+	double WarmUpFrameBudgetSeconds = 0.0;
+	FTSTicker::FDelegateHandle WarmUpTickerHandle;
+	TSharedPtr<FStreamableHandle> WarmUpLoadHandle;
+
+	/** Whether AcquireEntryWidget defers entries outside ProgressiveConstructionRadius. */
+	bool bIsConstructingProgressively = false;
+
+	/** Global indices deferred by progressive construction; may hold stale indices, BuildDeferredEntryWidget skips them. */
+	TArray<int32> DeferredConstructionGlobalIndices;
+
+	FTSTicker::FDelegateHandle ProgressiveConstructionTickerHandle;
+
+	/** Set between a hibernating NativeDestruct and the next NativeConstruct. */
+	bool bIsHibernating = false;
+
+	/**
+	 * Provider deltas received while hibernating, concatenated. A delta's changes apply in order, each to the items as
+	 * left by the one before, so appending them keeps this a single valid delta.
+	 */
+	FStrategyDataProviderDelta HibernatedProviderDelta;
+
+	/** Whether a full provider update arrived while hibernating, superseding HibernatedProviderDelta. */
+	bool bHibernatedProviderRefreshPending = false;
+
+	/** FWorldDelegates::OnWorldCleanup binding held while hibernating. */
+	FDelegateHandle HibernatingWorldCleanupHandle;
+
+	/** Next-tick timer that flushes DirtyEntryStateGlobalIndices, for changes made outside UpdateWidgets. */
+	FTimerHandle EntryStateFlushTimerHandle;
 #pragma endregion
 
 #pragma region UBaseStrategyWidget Properties - Focus & Selection
 	/**
-	 * Contains zero or more selected data indices. Used if multi‐select is allowed;
-	 * otherwise it typically has one entry or none.
+	 * One bit per data index, set if that item is selected. Used if multi‐select is allowed;
+	 * otherwise it typically has one bit set or none. Use GetSelectedDataIndices() from Blueprint.
 	 */
-	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|Selection")
-	TSet<int32> SelectedDataIndices;
+	TBitArray<> SelectedDataIndices;
 
 	/**
 	 * Raw global "cursor" or "focus" index, can be outside the array range.
@@ -455,4 +1209,36 @@ protected:
 	virtual void UpdateReflectedObjectsDebugCategory();
 #endif
 #pragma endregion
+
+#pragma region UBaseStrategyWidget - Stats
+	/** FrameStats, starting over first thing in a new frame. */
+	FStrategyWidgetFrameStats& GetCurrentFrameStats();
+
+	/** Counts an entry widget handed out by AcquireEntryWidget (from the shared pool if bPoolHit). */
+	void RecordEntryAcquired(bool bPoolHit);
+
+	/** Counts an entry (or placeholder) widget released by this widget. */
+	void RecordEntryReleased();
+
+	/** Counts an IStrategyEntryBase event sent to an entry widget. */
+	void RecordBlueprintDispatch();
+
+	/** Counts an async load completed RequestTime (FPlatformTime::Seconds) after it was requested. */
+	void RecordAsyncLoadCompleted(double RequestTime);
+
+	/** Brings the Live Slots stat and FrameStats in line with the current number of slots. */
+	void RecordLiveSlots();
+
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="StrategyUI|BaseStrategyWidget|Stats")
+	FStrategyWidgetFrameStats FrameStats;
+
+	// Our share of the Live Slots accumulator
+	int32 ReportedLiveSlots = 0;
+
+	// "UpdateWidgets [Name]" in `stat StrategyUI`, and the same name on the StrategyUI trace channel
+	FString InstanceStatName;
+#if STATS
+	TStatId InstanceUpdateWidgetsStatId;
+#endif
+#pragma endregion
 };
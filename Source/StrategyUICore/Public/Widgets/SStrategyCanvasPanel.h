@@ -3,6 +3,9 @@
 #include <CoreMinimal.h>
 #include <Widgets/SPanel.h>
 #include <Layout/Children.h>
+#include <Layout/ArrangedChildren.h>
+#include <Fonts/SlateFontInfo.h>
+#include <Styling/CoreStyle.h>
 #include <Slate/SRetainerWidget.h>
 #include <UObject/GCObject.h>
 
@@ -28,6 +31,43 @@ struct FStrategyCanvasSlotData_Minimal
 	}
 };
 
+/**
+ * A lightweight stand-in for an entry that doesn't warrant a real widget (far from focus, deactivated, ...).
+ * Proxies have no widget or UObject behind them, the panel just draws a brush and optional label for each.
+ */
+struct FStrategyCanvasProxyEntry
+{
+	/** Position relative to the panel center, same as child slots */
+	FVector2D Position = FVector2D::ZeroVector;
+	/** Proxies are drawn back-to-front, below all child widgets */
+	float Depth = 0.f;
+	/** Drawn size, centered on Position */
+	FVector2D Size = FVector2D(32.f, 32.f);
+	/** Brush to draw; must outlive the proxy (e.g. a UPROPERTY on the owning widget). Nothing is drawn if null. */
+	const FSlateBrush* Brush = nullptr;
+	FLinearColor Tint = FLinearColor::White;
+	/** Optional label, drawn centered on the brush */
+	FText Label;
+};
+
+/**
+ * Stable handle to a child slot of SStrategyCanvasPanel.
+ * Slot indices never shift when other children are removed; the generation invalidates handles to freed (and reused) slots.
+ */
+struct FStrategyCanvasSlotHandle
+{
+	int32 SlotIndex = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return SlotIndex != INDEX_NONE; }
+	void Reset() { SlotIndex = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const FStrategyCanvasSlotHandle& Other) const
+	{
+		return SlotIndex == Other.SlotIndex && Generation == Other.Generation;
+	}
+};
+
 /**
  * SStrategyCanvasPanel is a pure Slate container that arranges children at explicit positions with a given depth.
  * It is designed to be as lean as possible. All UUserWidget (or other UObject/Unreal) logic should be handled in the implementing UWidget.
@@ -49,9 +89,41 @@ public:
 	 * Update the children data with minimal layout data.
 	 * The parameter InSlotData maps a global index (as defined by UBaseStrategyWidget)
 	 * to a minimal data struct containing only the position, depth, and Slate widget to show.
+	 *
+	 * Convenience wrapper over the per-slot API below; only the slots that actually changed are touched.
 	 */
 	void UpdateChildrenData(const TMap<int32, FStrategyCanvasSlotData_Minimal>& InSlotData);
 
+	//----------------------------------------------------------------------------------------------
+	// Per-slot API
+	//----------------------------------------------------------------------------------------------
+	/** Adds a child, reusing a freed slot if there is one. Invalidates the child order. */
+	FStrategyCanvasSlotHandle AddChildSlot(const FStrategyCanvasSlotData_Minimal& InSlotData);
+
+	/** Removes a child. The slot is freed for reuse and Handle (plus any copies) become stale. Invalidates the child order. */
+	void RemoveChildSlot(const FStrategyCanvasSlotHandle& Handle);
+
+	/** Moves a child. Only invalidates paint, since children are arranged while painting. */
+	void SetChildSlotPosition(const FStrategyCanvasSlotHandle& Handle, const FVector2D& InPosition, float InDepth);
+
+	/** Swaps the widget shown in a slot (e.g. placeholder -> loaded widget). No-op if it's the same widget. */
+	void SetChildSlotWidget(const FStrategyCanvasSlotHandle& Handle, const TSharedRef<SWidget>& InWidget);
+
+	/** Whether Handle still refers to a live slot. */
+	bool IsValidChildSlot(const FStrategyCanvasSlotHandle& Handle) const;
+
+	/** Removes every child and frees all slots, invalidating all outstanding handles. */
+	void ClearChildSlots();
+
+	//----------------------------------------------------------------------------------------------
+	// Proxy entries
+	//----------------------------------------------------------------------------------------------
+	/** Replaces the proxy entries drawn under the children. Only invalidates paint. */
+	void SetProxyEntries(TConstArrayView<FStrategyCanvasProxyEntry> InProxyEntries);
+
+	/** Font used for proxy labels */
+	void SetProxyFont(const FSlateFontInfo& InFont) { ProxyFont = InFont; }
+
 	void SetDebugPaint(const bool bEnable) { bDebugPaint = bEnable; }
 
 	// SPanel overrides
@@ -80,6 +152,16 @@ private:
 		float Depth = 0.f;
 		TWeakPtr<SWidget> Widget;
 
+		/** Bumped whenever the slot is freed, so stale handles stop matching. */
+		uint32 Generation = 0;
+		bool bInUse = false;
+
+		/**
+		 * Set when Widget is new to this slot and hasn't been through a Slate prepass as our child yet.
+		 * After that, the regular prepass keeps its desired size current whenever it invalidates layout.
+		 */
+		mutable bool bNeedsPrepass = true;
+
 		FString ToString() const
 		{
 			return FString::Printf(TEXT("Position: %s, Depth: %f, Widget: %s"),
@@ -87,17 +169,43 @@ private:
 		}
 	};
 
-	/** The array of children slots */
+	/** Returns the live slot for Handle, or nullptr if it's stale. */
+	FStrategyCanvasChildSlot_Internal* FindChildSlot(const FStrategyCanvasSlotHandle& Handle);
+
+	/** Rebuilds SortedSlotIndices if slots were added, removed or changed depth. */
+	void UpdateSortedSlotIndices() const;
+
+	/**
+	 * The array of children slots.
+	 * Slots are never removed (so indices stay stable), freed slots just hold the null widget until reused.
+	 */
 	TPanelChildren<FStrategyCanvasChildSlot_Internal> Children;
 
+	/** Indices of freed slots in Children, ready for reuse */
+	TArray<int32> FreeSlotIndices;
+
+	/** Live slot indices sorted back-to-front by depth, cached between arranges */
+	mutable TArray<int32> SortedSlotIndices;
+	mutable bool bSortedSlotsDirty = true;
+
+	/** Arrange output for OnPaint, kept between paints so its array only grows; emptied after each paint so it holds no widgets */
+	mutable FArrangedChildren PaintArrangedChildren{ EVisibility::Visible };
+
 	/** A helper that combines all children */
 	FCombinedChildren CombinedChildren;
 
 	/**
-	 * Mapping from the “global index” (provided by the host widget) to an index in our Children array.
-	 * This lets us update or remove individual children efficiently.
+	 * Mapping from the “global index” (provided by the host widget) to a slot in our Children array.
+	 * Only used by UpdateChildrenData; the per-slot API is keyed by handle alone.
 	 */
-	TMap<int32, int32> GlobalIndexToSlot;
+	TMap<int32, FStrategyCanvasSlotHandle> GlobalIndexToSlot;
+
+	/** Proxy entries, kept sorted back-to-front */
+	TArray<FStrategyCanvasProxyEntry> ProxyEntries;
+	FSlateFontInfo ProxyFont = FCoreStyle::GetDefaultFontStyle("Regular", 10);
+
+	/** Draws ProxyEntries starting at LayerId, returns the first layer above them */
+	int32 PaintProxyEntries(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle) const;
 
 	bool bDebugPaint = false;
 };
@@ -0,0 +1,72 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Blueprint/UserWidget.h>
+
+#include "Interfaces/IStrategyEntryBase.h"
+#include "Utils/StrategyEntryState.h"
+
+#include "StrategyEntryWidgetBase.generated.h"
+
+/** The IStrategyEntryBase events a Blueprint can implement. */
+enum class EStrategyEntryEvents : uint8
+{
+	None             = 0,
+	ItemAssigned     = 1 << 0,
+	StateTagsChanged = 1 << 1,
+	FocusChanged     = 1 << 2,
+	SelectionChanged = 1 << 3,
+};
+ENUM_CLASS_FLAGS(EStrategyEntryEvents);
+
+/** How a strategy widget notifies an entry widget, resolved once per widget and cached on its slot. */
+enum class EStrategyEntryDispatch : uint8
+{
+	Unresolved,
+	None,      // Doesn't implement IStrategyEntryBase
+	Interface, // Implements IStrategyEntryBase only, every event goes through the Blueprint thunks
+	Native,    // A UStrategyEntryWidgetBase, events are virtual calls
+};
+
+/**
+ * Entry widget base with native C++ hooks for every IStrategyEntryBase event.
+ * Strategy widgets call the hooks directly. By default each hook forwards to the matching BP_ event, but only if a
+ * Blueprint subclass implements it, so entries written in C++ (or with only some events in Blueprint) skip
+ * ProcessEvent entirely.
+ */
+UCLASS(Abstract)
+class STRATEGYUI_API UStrategyEntryWidgetBase : public UUserWidget, public IStrategyEntryBase
+{
+	GENERATED_BODY()
+
+public:
+	//----------------------------------------------------------------------------------------------
+	// UStrategyEntryWidgetBase - Native Hooks
+	//----------------------------------------------------------------------------------------------
+#pragma region UStrategyEntryWidgetBase - Native Hooks
+	/** Called when the widget is assigned new data. Forwards to BP_OnStrategyEntryItemAssigned. */
+	virtual void NativeOnStrategyEntryItemAssigned(const UObject* InItem);
+
+	/** Called when this entry widget transitions states. Forwards to BP_OnStrategyEntryStateTagsChanged. */
+	virtual void NativeOnStrategyEntryStateChanged(EStrategyEntryState OldState, EStrategyEntryState NewState);
+
+	/** Forwards to BP_OnItemFocusChanged. */
+	virtual void NativeOnItemFocusChanged(bool bIsFocused);
+
+	/** Forwards to BP_OnItemSelectionChanged. */
+	virtual void NativeOnItemSelectionChanged(bool bIsSelected);
+#pragma endregion
+
+	/** The IStrategyEntryBase events this widget's class implements in Blueprint. */
+	EStrategyEntryEvents GetBlueprintEntryEvents() const;
+
+	/** How Widget should be notified of IStrategyEntryBase events. */
+	static EStrategyEntryDispatch ResolveEntryDispatch(const UUserWidget* Widget);
+
+private:
+	/** Resolved on first use, the class can't change afterwards */
+	mutable EStrategyEntryEvents BlueprintEntryEvents = EStrategyEntryEvents::None;
+	mutable bool bHasResolvedBlueprintEntryEvents = false;
+};
@@ -0,0 +1,357 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "ExampleStrategies/GridLayoutStrategy.h"
+
+#include <Rendering/DrawElements.h>
+
+#include <Utils/LogStrategyUI.h>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GridLayoutStrategy)
+
+#if WITH_EDITOR
+void UGridLayoutStrategy::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CellSize = FVector2D::Max(CellSize, FVector2D(1.f));
+	CellSpacing = FVector2D::Max(CellSpacing, FVector2D::ZeroVector);
+	UpdateGridMetrics();
+	SetScrollOffset(ScrollOffset);
+}
+#endif
+
+//--------------------------------------------------------------------------
+// BaseLayoutStrategy overrides
+//--------------------------------------------------------------------------
+void UGridLayoutStrategy::InitializeStrategy(const TScriptInterface<ILayoutStrategyHost> Host)
+{
+	Super::InitializeStrategy(Host);
+
+	if (!ensureMsgf(Host, TEXT("Host is null in %hs!"), __FUNCTION__))
+	{
+		return;
+	}
+	NumItems = FMath::Max(0, ILayoutStrategyHost::Execute_GetNumItems(Host.GetObject()));
+
+	UpdateGridMetrics();
+
+	// The item count may have shrunk below what was scrolled to
+	SetScrollOffset(ScrollOffset);
+	if (FocusedGlobalIndex >= NumItems)
+	{
+		FocusedGlobalIndex = NumItems - 1;
+	}
+}
+
+void UGridLayoutStrategy::ValidateStrategy(TArray<FText>& OutErrors) const
+{
+	if (CellSize.X <= 0.f || CellSize.Y <= 0.f)
+	{
+		OutErrors.Add(FText::FromString(TEXT("CellSize must be greater than 0 on both axes!")));
+	}
+
+	if (CellSpacing.X < 0.f || CellSpacing.Y < 0.f)
+	{
+		OutErrors.Add(FText::FromString(TEXT("CellSpacing can't be negative!")));
+	}
+}
+
+FVector2D UGridLayoutStrategy::GetItemPosition(const int32 GlobalIndex) const
+{
+	const int32 Row = GlobalIndex / ResolvedNumColumns;
+	const int32 Column = GlobalIndex % ResolvedNumColumns;
+	return MakeCellPosition(GetRowCenter(Row), GetColumnCenter(Column));
+}
+
+void UGridLayoutStrategy::ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 FirstGlobalIndex = FMath::Max(GlobalIndexRange.GetLowerBoundValue(), 0);
+	const int32 Count = FMath::Min(GlobalIndexRange.GetUpperBoundValue() - FirstGlobalIndex, OutPositions.Num());
+
+	// Cells are uniform, so walking the window is a running add per entry and a wrap per row
+	const float RowPitch = GetRowPitch();
+	const float ColumnPitch = GetColumnPitch();
+	const float FirstColumnCenter = GetColumnCenter(0);
+
+	int32 Column = FirstGlobalIndex % ResolvedNumColumns;
+	float MainAxis = GetRowCenter(FirstGlobalIndex / ResolvedNumColumns);
+	float CrossAxis = GetColumnCenter(Column);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutPositions[i] = MakeCellPosition(MainAxis, CrossAxis);
+
+		if (++Column == ResolvedNumColumns)
+		{
+			Column = 0;
+			CrossAxis = FirstColumnCenter;
+			MainAxis += RowPitch;
+		}
+		else
+		{
+			CrossAxis += ColumnPitch;
+		}
+	}
+}
+
+int32 UGridLayoutStrategy::FindFocusedGlobalIndex() const
+{
+	if (NumItems <= 0 || VisibleStartIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if (FocusedGlobalIndex == INDEX_NONE)
+	{
+		return VisibleStartIndex;
+	}
+
+	// Focus follows the content when scrolled out of view, keeping its column
+	const int32 FirstVisibleRow = VisibleStartIndex / ResolvedNumColumns;
+	const int32 LastVisibleRow = VisibleEndIndex / ResolvedNumColumns;
+	const int32 Row = FMath::Clamp(FocusedGlobalIndex / ResolvedNumColumns, FirstVisibleRow, LastVisibleRow);
+	const int32 Column = FocusedGlobalIndex % ResolvedNumColumns;
+	return FMath::Min(Row * ResolvedNumColumns + Column, VisibleEndIndex);
+}
+
+int32 UGridLayoutStrategy::GetGlobalIndexDistance(const int32 GlobalIndexA, const int32 GlobalIndexB) const
+{
+	// Cells away on the grid, diagonals counting as one
+	const int32 RowDistance = FMath::Abs(GlobalIndexA / ResolvedNumColumns - GlobalIndexB / ResolvedNumColumns);
+	const int32 ColumnDistance = FMath::Abs(GlobalIndexA % ResolvedNumColumns - GlobalIndexB % ResolvedNumColumns);
+	return FMath::Max(RowDistance, ColumnDistance);
+}
+
+FInt32Range UGridLayoutStrategy::ComputeDesiredGlobalIndexRange()
+{
+	const int32 NumRows = GetNumRows();
+	const float RowPitch = GetRowPitch();
+	const float ViewportMain = (Orientation == EGridLayoutOrientation::Vertical) ? ViewportSize.Y : ViewportSize.X;
+	if (NumRows <= 0 || RowPitch <= 0.f || ViewportMain <= 0.f)
+	{
+		VisibleStartIndex = INDEX_NONE;
+		VisibleEndIndex = INDEX_NONE;
+		return FInt32Range::Empty();
+	}
+
+	// Straight from the scroll offset, regardless of how many items there are
+	const int32 FirstVisibleRow = FMath::Clamp(FMath::FloorToInt((ScrollOffset - ContentPadding) / RowPitch), 0, NumRows - 1);
+	const int32 LastVisibleRow = FMath::Clamp(FMath::FloorToInt((ScrollOffset + ViewportMain - ContentPadding) / RowPitch), FirstVisibleRow, NumRows - 1);
+
+	VisibleStartIndex = FirstVisibleRow * ResolvedNumColumns;
+	VisibleEndIndex = FMath::Min((LastVisibleRow + 1) * ResolvedNumColumns, NumItems) - 1;
+
+	// Overscan whole rows, enough to cover NumDeactivatedEntries on each side
+	const int32 OverscanRows = FMath::DivideAndRoundUp(NumDeactivatedEntries, ResolvedNumColumns);
+	const int32 FirstDesiredRow = FMath::Max(FirstVisibleRow - OverscanRows, 0);
+	const int32 LastDesiredRow = FMath::Min(LastVisibleRow + OverscanRows, NumRows - 1);
+
+	const int32 Lower = FirstDesiredRow * ResolvedNumColumns;
+	const int32 Upper = FMath::Min((LastDesiredRow + 1) * ResolvedNumColumns, NumItems);
+	return FInt32Range(Lower, FMath::Min(Upper, Lower + GetMaxWindowEntryCount()));
+}
+
+int32 UGridLayoutStrategy::GlobalIndexToDataIndex(const int32 GlobalIndex) const
+{
+	return (GlobalIndex >= 0 && GlobalIndex < NumItems) ? GlobalIndex : INDEX_NONE;
+}
+
+bool UGridLayoutStrategy::ShouldBeVisible(const int32 GlobalIndex) const
+{
+	return (GlobalIndex >= VisibleStartIndex && GlobalIndex <= VisibleEndIndex);
+}
+
+void UGridLayoutStrategy::DrawDebugVisuals(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FVector2D& Center) const
+{
+	if (VisibleStartIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Outline every visible cell in green, the focused one in red
+	const FVector2D HalfCell = CellSize * 0.5f;
+	const int32 FocusedIndex = FindFocusedGlobalIndex();
+	for (int32 GlobalIndex = VisibleStartIndex; GlobalIndex <= VisibleEndIndex; ++GlobalIndex)
+	{
+		const FVector2D CellCenter = Center + GetItemPosition(GlobalIndex);
+		const TArray<FVector2D> CellPoints = {
+			CellCenter + FVector2D(-HalfCell.X, -HalfCell.Y),
+			CellCenter + FVector2D(HalfCell.X, -HalfCell.Y),
+			CellCenter + FVector2D(HalfCell.X, HalfCell.Y),
+			CellCenter + FVector2D(-HalfCell.X, HalfCell.Y),
+			CellCenter + FVector2D(-HalfCell.X, -HalfCell.Y),
+		};
+
+		FSlateDrawElement::MakeLines(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(),
+			CellPoints,
+			ESlateDrawEffect::None,
+			(GlobalIndex == FocusedIndex) ? FLinearColor::Red : FLinearColor::Green,
+			true,
+			1.f
+		);
+	}
+}
+
+//----------------------------------------------------------------------------------------------
+// Grid Layout Strategy API
+//----------------------------------------------------------------------------------------------
+void UGridLayoutStrategy::SetViewportSize(const FVector2D& InViewportSize)
+{
+	if (ViewportSize == InViewportSize)
+	{
+		return;
+	}
+
+	ViewportSize = InViewportSize;
+	UpdateGridMetrics();
+
+	// A bigger viewport can fit more, leaving less to scroll
+	SetScrollOffset(ScrollOffset);
+}
+
+float UGridLayoutStrategy::SetScrollOffset(const float InScrollOffset)
+{
+	ScrollOffset = FMath::Clamp(InScrollOffset, 0.f, GetMaxScrollOffset());
+	return ScrollOffset;
+}
+
+float UGridLayoutStrategy::GetMaxScrollOffset() const
+{
+	const int32 NumRows = GetNumRows();
+	if (NumRows <= 0)
+	{
+		return 0.f;
+	}
+
+	const bool bVertical = (Orientation == EGridLayoutOrientation::Vertical);
+	const float SpacingMain = bVertical ? CellSpacing.Y : CellSpacing.X;
+	const float ViewportMain = bVertical ? ViewportSize.Y : ViewportSize.X;
+
+	// The last row needs no spacing after it
+	const float ContentMain = NumRows * GetRowPitch() - SpacingMain + 2.f * ContentPadding;
+	return FMath::Max(ContentMain - ViewportMain, 0.f);
+}
+
+float UGridLayoutStrategy::GetScrollOffsetToBringIntoView(const int32 GlobalIndex) const
+{
+	if (GlobalIndex < 0 || GlobalIndex >= NumItems)
+	{
+		return ScrollOffset;
+	}
+
+	const bool bVertical = (Orientation == EGridLayoutOrientation::Vertical);
+	const float CellMain = bVertical ? CellSize.Y : CellSize.X;
+	const float ViewportMain = bVertical ? ViewportSize.Y : ViewportSize.X;
+
+	// Include the padding when reaching either end, so the first/last row doesn't sit flush with the edge
+	const int32 Row = GlobalIndex / ResolvedNumColumns;
+	if (Row == 0)
+	{
+		return 0.f;
+	}
+	if (Row == GetNumRows() - 1)
+	{
+		return GetMaxScrollOffset();
+	}
+
+	const float RowStart = ContentPadding + Row * GetRowPitch();
+	const float RowEnd = RowStart + CellMain;
+	if (RowStart < ScrollOffset)
+	{
+		return RowStart;
+	}
+	if (RowEnd > ScrollOffset + ViewportMain)
+	{
+		return RowEnd - ViewportMain;
+	}
+	return ScrollOffset;
+}
+
+void UGridLayoutStrategy::SetFocusedGlobalIndex(const int32 InGlobalIndex)
+{
+	FocusedGlobalIndex = (InGlobalIndex == INDEX_NONE || NumItems <= 0)
+		? INDEX_NONE
+		: FMath::Clamp(InGlobalIndex, 0, NumItems - 1);
+}
+
+int32 UGridLayoutStrategy::GetNeighbourGlobalIndex(const int32 GlobalIndex, const int32 DeltaColumns, const int32 DeltaRows) const
+{
+	if (NumItems <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int64 Target = static_cast<int64>(GlobalIndex) + DeltaColumns + static_cast<int64>(DeltaRows) * ResolvedNumColumns;
+	return static_cast<int32>(FMath::Clamp<int64>(Target, 0, NumItems - 1));
+}
+
+float UGridLayoutStrategy::GetRowPitch() const
+{
+	return (Orientation == EGridLayoutOrientation::Vertical) ? CellSize.Y + CellSpacing.Y : CellSize.X + CellSpacing.X;
+}
+
+void UGridLayoutStrategy::UpdateGridMetrics()
+{
+	const bool bVertical = (Orientation == EGridLayoutOrientation::Vertical);
+	const float ViewportMain = bVertical ? ViewportSize.Y : ViewportSize.X;
+	const float ViewportCross = bVertical ? ViewportSize.X : ViewportSize.Y;
+	const float SpacingCross = bVertical ? CellSpacing.X : CellSpacing.Y;
+
+	const float ColumnPitch = GetColumnPitch();
+	if (NumColumns > 0)
+	{
+		ResolvedNumColumns = NumColumns;
+	}
+	else
+	{
+		// As many as fit, the last column needing no spacing after it
+		ResolvedNumColumns = (ColumnPitch > 0.f) ? FMath::Max(FMath::FloorToInt((ViewportCross + SpacingCross) / ColumnPitch), 1) : 1;
+	}
+
+	// A partly scrolled viewport shows parts of one more row than it fits whole
+	const float RowPitch = GetRowPitch();
+	const int32 RowsInView = (RowPitch > 0.f) ? FMath::CeilToInt(ViewportMain / RowPitch) + 1 : 1;
+	MaxVisibleEntries = FMath::Clamp(RowsInView * ResolvedNumColumns, 1, GetMaxWindowEntryCount());
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: %d columns, up to %d visible entries for a %s viewport"),
+		__FUNCTION__, ResolvedNumColumns, MaxVisibleEntries, *ViewportSize.ToString());
+}
+
+float UGridLayoutStrategy::GetColumnPitch() const
+{
+	return (Orientation == EGridLayoutOrientation::Vertical) ? CellSize.X + CellSpacing.X : CellSize.Y + CellSpacing.Y;
+}
+
+FVector2D UGridLayoutStrategy::MakeCellPosition(const float MainAxis, const float CrossAxis) const
+{
+	return (Orientation == EGridLayoutOrientation::Vertical) ? FVector2D(CrossAxis, MainAxis) : FVector2D(MainAxis, CrossAxis);
+}
+
+float UGridLayoutStrategy::GetRowCenter(const int32 Row) const
+{
+	const bool bVertical = (Orientation == EGridLayoutOrientation::Vertical);
+	const float CellMain = bVertical ? CellSize.Y : CellSize.X;
+	const float ViewportMain = bVertical ? ViewportSize.Y : ViewportSize.X;
+
+	return -0.5f * ViewportMain + ContentPadding + Row * GetRowPitch() + 0.5f * CellMain - ScrollOffset;
+}
+
+float UGridLayoutStrategy::GetColumnCenter(const int32 Column) const
+{
+	const bool bVertical = (Orientation == EGridLayoutOrientation::Vertical);
+	const float CellCross = bVertical ? CellSize.X : CellSize.Y;
+	const float SpacingCross = bVertical ? CellSpacing.X : CellSpacing.Y;
+
+	// Rows are centered across the viewport
+	const float RowWidth = ResolvedNumColumns * GetColumnPitch() - SpacingCross;
+	return -0.5f * RowWidth + Column * GetColumnPitch() + 0.5f * CellCross;
+}
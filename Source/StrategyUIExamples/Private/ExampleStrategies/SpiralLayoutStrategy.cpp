@@ -4,6 +4,33 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SpiralLayoutStrategy)
 
+namespace SpiralLayoutStrategy
+{
+	/** Spiral inputs on top of the radial ones; mirrors CalculateDistanceFactorForAngle and CalculateRadiusForGlobalIndex. */
+	struct FSpiralLayoutSnapshot : public FRadialLayoutSnapshot
+	{
+		float SpiralInwardOffset = 0.f;
+		float SpiralOutwardOffset = 0.f;
+		float DistanceFactorTurnThreshold = 0.f;
+
+		virtual float GetDistanceFactor(const int32 GlobalIndex) const override
+		{
+			const float TurnDiff = (PointerAngle - GetItemAngleDegrees(GlobalIndex)) / 360.f;
+			const float ClampedDiff = FMath::Clamp(TurnDiff, -DistanceFactorTurnThreshold, DistanceFactorTurnThreshold);
+			return FMath::GetMappedRangeValueClamped(
+				FVector2D(-DistanceFactorTurnThreshold, DistanceFactorTurnThreshold),
+				FVector2D(0.f, +1.f),
+				ClampedDiff
+			);
+		}
+
+		virtual float GetRadius(const int32 GlobalIndex) const override
+		{
+			return BaseRadius + FMath::Lerp(SpiralInwardOffset, SpiralOutwardOffset, GetDistanceFactor(GlobalIndex));
+		}
+	};
+}
+
 //--------------------------------------------------------------------------
 // BaseLayoutStrategy overrides
 //--------------------------------------------------------------------------
@@ -21,7 +48,54 @@ FVector2D USpiralLayoutStrategy::GetItemPosition(const int32 GlobalIndex) const
 	return FVector2D(PosX, PosY);
 }
 
+void USpiralLayoutStrategy::ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutPositions.Num());
+
+	// The desired window (or part of it) comes straight from the cached directions, no trig involved
+	if (IsInWindowCache(GlobalIndexRange))
+	{
+		UpdateWindowDistanceFactors();
+
+		const int32 CacheOffset = GlobalIndexRange.GetLowerBoundValue() - WindowCache.FirstGlobalIndex;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float Radius = BaseRadius + FMath::Lerp(SpiralInwardOffset, SpiralOutwardOffset, WindowCache.DistanceFactors[CacheOffset + i]);
+			OutPositions[i] = WindowCache.Directions[CacheOffset + i] * Radius;
+		}
+		return;
+	}
+
+	TArray<float, TInlineAllocator<MAX_ENTRY_COUNT>> AnglesDegrees;
+	TArray<float, TInlineAllocator<MAX_ENTRY_COUNT>> Radii;
+	AnglesDegrees.SetNumUninitialized(Count);
+	Radii.SetNumUninitialized(Count);
+
+	ComputeItemAnglesDegrees(GlobalIndexRange, AnglesDegrees);
+	ComputeDistanceFactors(GlobalIndexRange, Radii);
+
+	// Distance factors -> radii, in place
+	for (float& Radius : Radii)
+	{
+		Radius = BaseRadius + FMath::Lerp(SpiralInwardOffset, SpiralOutwardOffset, Radius);
+	}
+
+	ComputePolarPositions(AnglesDegrees, Radii, OutPositions);
+}
+
 int32 USpiralLayoutStrategy::FindFocusedGlobalIndex() const
+{
+	return FindGlobalIndexForAngle(GetPointerAngle());
+}
+
+int32 USpiralLayoutStrategy::FindGlobalIndexForAngle(const float InAngle) const
 {
 	const float EffectiveAngularSpacing = GetAngularSpacing();
 	if (FMath::IsNearlyZero(EffectiveAngularSpacing))
@@ -29,14 +103,56 @@ int32 USpiralLayoutStrategy::FindFocusedGlobalIndex() const
 		return 0;
 	}
 	// Spiral can have unbounded angles. We'll offset by half a wedge:
-	const float OffsetAngle = GetPointerAngle() + (EffectiveAngularSpacing * 0.5f);
+	const float OffsetAngle = InAngle + (EffectiveAngularSpacing * 0.5f);
 	return FMath::FloorToInt(OffsetAngle / EffectiveAngularSpacing);
 }
 
-TSet<int32> USpiralLayoutStrategy::ComputeDesiredGlobalIndices()
+FInt32Range USpiralLayoutStrategy::ComputeDesiredGlobalIndexRangeForAngle(const float InAngle) const
 {
-	DesiredGlobalIndices.Empty(MaxVisibleEntries);
+	// Same window as ComputeDesiredGlobalIndexRange, centered on whatever InAngle would focus
+	const int32 HalfWindow = MaxVisibleEntries / 2;
+	const int32 StartIndex = FindGlobalIndexForAngle(InAngle) - HalfWindow;
+	const int32 EndIndex = StartIndex + MaxVisibleEntries - 1;
+
+	int32 LowerMargin = 0;
+	int32 UpperMargin = 0;
+	GetDeactivatedMargins(LowerMargin, UpperMargin);
 
+	return FInt32Range(StartIndex - LowerMargin, EndIndex + UpperMargin + 1);
+}
+
+void USpiralLayoutStrategy::GetDeactivatedMargins(int32& OutLowerMargin, int32& OutUpperMargin) const
+{
+	if (!bUseAdaptiveDeactivatedMargin)
+	{
+		Super::GetDeactivatedMargins(OutLowerMargin, OutUpperMargin);
+		return;
+	}
+
+	const float Velocity = GetPointerAngularVelocity();
+	const float EffectiveAngularSpacing = GetAngularSpacing();
+	if (FMath::Abs(Velocity) <= IdleAngularVelocityThreshold || FMath::IsNearlyZero(EffectiveAngularSpacing))
+	{
+		OutLowerMargin = IdleDeactivatedEntries;
+		OutUpperMargin = IdleDeactivatedEntries;
+		return;
+	}
+
+	// Enough entries to cover the look-ahead time at the current speed. Global indices grow with the angle,
+	// so a positive velocity leads on the upper side.
+	const float EntriesPerSecond = FMath::Abs(Velocity) / EffectiveAngularSpacing;
+	const int32 LeadingMargin = FMath::Clamp(
+		FMath::CeilToInt(EntriesPerSecond * DeactivatedMarginLookAheadTime),
+		IdleDeactivatedEntries,
+		FMath::Max(MaxLeadingDeactivatedEntries, IdleDeactivatedEntries)
+	);
+
+	OutLowerMargin = (Velocity > 0.f) ? TrailingDeactivatedEntries : LeadingMargin;
+	OutUpperMargin = (Velocity > 0.f) ? LeadingMargin : TrailingDeactivatedEntries;
+}
+
+FInt32Range USpiralLayoutStrategy::ComputeDesiredGlobalIndexRange()
+{
 	// We'll pick a window half on each side of the focused item.
 	const int32 HalfWindow = MaxVisibleEntries / 2;
 	VisibleStartIndex = FindFocusedGlobalIndex() - HalfWindow;
@@ -44,14 +160,16 @@ TSet<int32> USpiralLayoutStrategy::ComputeDesiredGlobalIndices()
 	// The last index to show (inclusive):
 	VisibleEndIndex = VisibleStartIndex + MaxVisibleEntries - 1;
 	
-	const int32 ExtendedStart = VisibleStartIndex - NumDeactivatedEntries;
-	const int32 ExtendedEnd   = VisibleEndIndex + NumDeactivatedEntries;
+	int32 LowerMargin = 0;
+	int32 UpperMargin = 0;
+	GetDeactivatedMargins(LowerMargin, UpperMargin);
 
-	for (int32 i = ExtendedStart; i <= ExtendedEnd; ++i)
-	{
-		DesiredGlobalIndices.Add(i);
-	}
-	return DesiredGlobalIndices;
+	const int32 ExtendedStart = VisibleStartIndex - LowerMargin;
+	const int32 ExtendedEnd   = VisibleEndIndex + UpperMargin;
+
+	const FInt32Range DesiredRange(ExtendedStart, ExtendedEnd + 1);
+	UpdateWindowCache(DesiredRange);
+	return DesiredRange;
 }
 
 int32 USpiralLayoutStrategy::GlobalIndexToDataIndex(const int32 GlobalIndex) const
@@ -140,15 +258,15 @@ void USpiralLayoutStrategy::DrawDebugVisuals(const FGeometry& AllottedGeometry,
 
 		// Build a polyline from [CenterIndex - Range ... CenterIndex + Range].
 		TArray<FVector2D> SpiralPoints;
-		SpiralPoints.Reserve(RangeAroundFocus * 2 + 1);
+		SpiralPoints.SetNumUninitialized(RangeAroundFocus * 2 + 1);
 
-		for (int32 i = CenterGlobalIndex - RangeAroundFocus; i <= CenterGlobalIndex + RangeAroundFocus; ++i)
-		{
-			// Get the *local position* of item i (0,0 is the center).
-			FVector2D LocalPos = GetItemPosition(i);
+		// Get the *local positions* of the whole range at once (0,0 is the center).
+		ComputeItemPositions(FInt32Range(CenterGlobalIndex - RangeAroundFocus, CenterGlobalIndex + RangeAroundFocus + 1), SpiralPoints);
 
-			// Shift by the actual widget center to make it screen-space
-			SpiralPoints.Add(Center + LocalPos);
+		// Shift by the actual widget center to make them screen-space
+		for (FVector2D& Point : SpiralPoints)
+		{
+			Point += Center;
 		}
 
 		// Finally, issue the draw call. We get a single continuous line.
@@ -174,15 +292,15 @@ void USpiralLayoutStrategy::DrawDebugVisuals(const FGeometry& AllottedGeometry,
 
 		// Build a polyline from [CenterIndex - Range ... CenterIndex + Range].
 		TArray<FVector2D> SpiralPoints;
-		SpiralPoints.Reserve(RangeAroundFocus * 2 + 1);
+		SpiralPoints.SetNumUninitialized(RangeAroundFocus * 2 + 1);
 
-		for (int32 i = CenterGlobalIndex - RangeAroundFocus; i <= CenterGlobalIndex + RangeAroundFocus; ++i)
-		{
-			// Get the *local position* of item i (0,0 is the center).
-			FVector2D LocalPos = GetItemPosition(i);
+		// Get the *local positions* of the whole range at once (0,0 is the center).
+		ComputeItemPositions(FInt32Range(CenterGlobalIndex - RangeAroundFocus, CenterGlobalIndex + RangeAroundFocus + 1), SpiralPoints);
 
-			// Shift by the actual widget center to make it screen-space
-			SpiralPoints.Add(Center + LocalPos);
+		// Shift by the actual widget center to make them screen-space
+		for (FVector2D& Point : SpiralPoints)
+		{
+			Point += Center;
 		}
 
 		// Finally, issue the draw call. We get a single continuous line.
@@ -269,9 +387,18 @@ float USpiralLayoutStrategy::CalculateItemAngleDegreesForGlobalIndex(const int32
 
 float USpiralLayoutStrategy::CalculateDistanceFactorForGlobalIndex(const int32 GlobalIndex) const
 {
+	if (WindowCache.Contains(GlobalIndex) && WindowCache.AngularSpacing == GetAngularSpacing())
+	{
+		UpdateWindowDistanceFactors();
+		return WindowCache.DistanceFactors[GlobalIndex - WindowCache.FirstGlobalIndex];
+	}
+
 	// Item angle is fixed, but radius depends on partial turn difference
-	const float ItemAngleDeg = CalculateItemAngleDegreesForGlobalIndex(GlobalIndex);
+	return CalculateDistanceFactorForAngle(CalculateItemAngleDegreesForGlobalIndex(GlobalIndex));
+}
 
+float USpiralLayoutStrategy::CalculateDistanceFactorForAngle(const float ItemAngleDeg) const
+{
 	const float PointerTurns = GetPointerAngle() / 360.f;
 	const float ItemTurns = ItemAngleDeg / 360.f;
 	const float TurnDiff = PointerTurns - ItemTurns;
@@ -291,4 +418,157 @@ float USpiralLayoutStrategy::CalculateRadiusForGlobalIndex(const int32 GlobalInd
 
 	const float Offset = FMath::Lerp(SpiralInwardOffset, SpiralOutwardOffset, DistanceFactor);
 	return BaseRadius + Offset;
-}
\ No newline at end of file
+}
+
+void USpiralLayoutStrategy::ComputeItemAnglesDegrees(const FInt32Range& GlobalIndexRange, TArrayView<float> OutAnglesDegrees) const
+{
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutAnglesDegrees.Num());
+	const float EffectiveAngularSpacing = GetAngularSpacing();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutAnglesDegrees[i] = (FirstGlobalIndex + i) * EffectiveAngularSpacing;
+	}
+}
+
+void USpiralLayoutStrategy::ComputeDistanceFactors(const FInt32Range& GlobalIndexRange, TArrayView<float> OutDistanceFactors) const
+{
+	if (GlobalIndexRange.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutDistanceFactors.Num());
+	if (IsInWindowCache(GlobalIndexRange))
+	{
+		UpdateWindowDistanceFactors();
+		FMemory::Memcpy(OutDistanceFactors.GetData(), &WindowCache.DistanceFactors[FirstGlobalIndex - WindowCache.FirstGlobalIndex], Count * sizeof(float));
+		return;
+	}
+
+	const float EffectiveAngularSpacing = GetAngularSpacing();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutDistanceFactors[i] = CalculateDistanceFactorForAngle((FirstGlobalIndex + i) * EffectiveAngularSpacing);
+	}
+}
+
+TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> USpiralLayoutStrategy::MakeLayoutSnapshot(const float InPointerAngle) const
+{
+	TSharedPtr<SpiralLayoutStrategy::FSpiralLayoutSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<SpiralLayoutStrategy::FSpiralLayoutSnapshot, ESPMode::ThreadSafe>();
+	FillLayoutSnapshot(*Snapshot, InPointerAngle);
+	Snapshot->SpiralInwardOffset = SpiralInwardOffset;
+	Snapshot->SpiralOutwardOffset = SpiralOutwardOffset;
+	Snapshot->DistanceFactorTurnThreshold = DistanceFactorTurnThreshold;
+	return Snapshot;
+}
+
+void USpiralLayoutStrategy::UpdateWindowCache(const FInt32Range& GlobalIndexRange) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const int32 FirstGlobalIndex = GlobalIndexRange.IsEmpty() ? 0 : GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Max(GlobalIndexRange.Size<int32>(), 0);
+	const float EffectiveAngularSpacing = GetAngularSpacing();
+
+	int32 CachedLower = WindowCache.FirstGlobalIndex;
+	int32 CachedUpper = WindowCache.FirstGlobalIndex + WindowCache.Num();
+	if (CachedLower == FirstGlobalIndex && CachedUpper == FirstGlobalIndex + Count && WindowCache.AngularSpacing == EffectiveAngularSpacing)
+	{
+		return; // Same window, the pointer only moved within its wedge
+	}
+
+	// Nothing to keep after a jump or a change of spacing
+	if (WindowCache.AngularSpacing != EffectiveAngularSpacing || FirstGlobalIndex >= CachedUpper || FirstGlobalIndex + Count <= CachedLower)
+	{
+		WindowCache.Directions.Reset();
+		CachedLower = CachedUpper = FirstGlobalIndex;
+	}
+
+	// Align the kept entries with the new first index; the window is small, so the shift is a short memmove
+	if (FirstGlobalIndex > CachedLower)
+	{
+		WindowCache.Directions.RemoveAt(0, FirstGlobalIndex - CachedLower, EAllowShrinking::No);
+	}
+	else if (FirstGlobalIndex < CachedLower)
+	{
+		WindowCache.Directions.InsertUninitialized(0, CachedLower - FirstGlobalIndex);
+	}
+	WindowCache.Directions.SetNumUninitialized(Count, EAllowShrinking::No);
+	WindowCache.DistanceFactors.SetNumUninitialized(Count, EAllowShrinking::No);
+
+	WindowCache.FirstGlobalIndex = FirstGlobalIndex;
+	WindowCache.AngularSpacing = EffectiveAngularSpacing;
+	WindowCache.bDistanceFactorsValid = false;
+
+	// Only the entries that just entered either end need their direction evaluated
+	const int32 KeptBegin = FMath::Clamp(CachedLower - FirstGlobalIndex, 0, Count);
+	const int32 KeptEnd = FMath::Clamp(CachedUpper - FirstGlobalIndex, KeptBegin, Count);
+	auto FillDirections = [this, FirstGlobalIndex, EffectiveAngularSpacing](const int32 Begin, const int32 End)
+	{
+		for (int32 i = Begin; i < End; ++i)
+		{
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians((FirstGlobalIndex + i) * EffectiveAngularSpacing));
+			WindowCache.Directions[i] = FVector2D(Cos, Sin);
+		}
+	};
+	FillDirections(0, KeptBegin);
+	FillDirections(KeptEnd, Count);
+}
+
+void USpiralLayoutStrategy::UpdateWindowDistanceFactors() const
+{
+	const float PointerAngle = GetPointerAngle();
+	if (WindowCache.bDistanceFactorsValid
+		&& WindowCache.DistanceFactorsPointerAngle == PointerAngle
+		&& WindowCache.DistanceFactorsTurnThreshold == DistanceFactorTurnThreshold)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Same mapping as CalculateDistanceFactorForAngle: the turn difference to the pointer mapped from
+	// [-Threshold, Threshold] to [0, 1]. It drops by a constant step per entry, so the pass is a multiply-add each.
+	const int32 Count = WindowCache.Num();
+	const float TwiceThreshold = 2.f * DistanceFactorTurnThreshold;
+	if (FMath::IsNearlyZero(TwiceThreshold))
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			WindowCache.DistanceFactors[i] = CalculateDistanceFactorForAngle((WindowCache.FirstGlobalIndex + i) * WindowCache.AngularSpacing);
+		}
+	}
+	else
+	{
+		const float InvTwiceThreshold = 1.f / TwiceThreshold;
+		const float TurnsPerEntry = WindowCache.AngularSpacing / 360.f;
+		const float FirstTurnDiff = (PointerAngle - WindowCache.FirstGlobalIndex * WindowCache.AngularSpacing) / 360.f;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const float TurnDiff = FirstTurnDiff - i * TurnsPerEntry;
+			WindowCache.DistanceFactors[i] = FMath::Clamp((TurnDiff + DistanceFactorTurnThreshold) * InvTwiceThreshold, 0.f, 1.f);
+		}
+	}
+
+	WindowCache.DistanceFactorsPointerAngle = PointerAngle;
+	WindowCache.DistanceFactorsTurnThreshold = DistanceFactorTurnThreshold;
+	WindowCache.bDistanceFactorsValid = true;
+}
+
+bool USpiralLayoutStrategy::IsInWindowCache(const FInt32Range& GlobalIndexRange) const
+{
+	if (GlobalIndexRange.IsEmpty() || WindowCache.AngularSpacing != GetAngularSpacing())
+	{
+		return false;
+	}
+
+	return WindowCache.Contains(GlobalIndexRange.GetLowerBoundValue()) && WindowCache.Contains(GlobalIndexRange.GetUpperBoundValue() - 1);
+}
@@ -6,6 +6,16 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(WheelLayoutStrategy)
 
+#if WITH_EDITOR
+void UWheelLayoutStrategy::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	UpdateAngularSpacing();
+	UpdatePositionTable();
+}
+#endif
+
 //--------------------------------------------------------------------------
 // BaseLayoutStrategy overrides
 //--------------------------------------------------------------------------
@@ -23,26 +33,61 @@ void UWheelLayoutStrategy::InitializeStrategy(TScriptInterface<ILayoutStrategyHo
 	
 	UpdateGapSegments(NumItems);
 	UpdateAngularSpacing();
+	UpdatePositionTable();
 }
 
 FVector2D UWheelLayoutStrategy::GetItemPosition(const int32 GlobalIndex) const
 {
-	const int32 ClampedIndex = FMath::Clamp(GlobalIndex, 0, RadialSegmentCount - 1);
+	UpdatePositionTable();
+	if (CachedSegmentPositions.IsEmpty())
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const int32 ClampedIndex = FMath::Clamp(GlobalIndex, 0, CachedSegmentPositions.Num() - 1);
+	return CachedSegmentPositions[ClampedIndex];
+}
+
+void UWheelLayoutStrategy::ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	UpdatePositionTable();
+	if (GlobalIndexRange.IsEmpty() || CachedSegmentPositions.IsEmpty())
+	{
+		return;
+	}
 
-	const float Degrees = static_cast<float>(ClampedIndex) * AngularSpacing;
-	const float Radians = FMath::DegreesToRadians(Degrees);
+	const int32 FirstGlobalIndex = GlobalIndexRange.GetLowerBoundValue();
+	const int32 Count = FMath::Min(GlobalIndexRange.Size<int32>(), OutPositions.Num());
 
-	// Simply place the item around the fixed radius
-	const float X = BaseRadius * FMath::Cos(Radians);
-	const float Y = BaseRadius * FMath::Sin(Radians);
+	// The common case (the whole wheel) is a straight copy
+	if (FirstGlobalIndex >= 0 && FirstGlobalIndex + Count <= CachedSegmentPositions.Num())
+	{
+		FMemory::Memcpy(OutPositions.GetData(), &CachedSegmentPositions[FirstGlobalIndex], Count * sizeof(FVector2D));
+		return;
+	}
 
-	return FVector2D(X, Y);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutPositions[i] = CachedSegmentPositions[FMath::Clamp(FirstGlobalIndex + i, 0, CachedSegmentPositions.Num() - 1)];
+	}
 }
 
 int32 UWheelLayoutStrategy::FindFocusedGlobalIndex() const
 {
+	return FindGlobalIndexForAngle(LatestPointerAngle);
+}
+
+int32 UWheelLayoutStrategy::FindGlobalIndexForAngle(const float InAngle) const
+{
+	if (FMath::IsNearlyZero(AngularSpacing))
+	{
+		return 0;
+	}
+
 	// Clamp to [0..360] since we don't need to worry about multiple turn cycles in a wheel
-	float CleanAngle = FMath::Fmod(LatestPointerAngle, 360.f);
+	float CleanAngle = FMath::Fmod(InAngle, 360.f);
 	if (CleanAngle < 0.f)
 	{
 		CleanAngle += 360.f;
@@ -58,21 +103,26 @@ int32 UWheelLayoutStrategy::FindFocusedGlobalIndex() const
 	return FMath::FloorToInt(CleanAngle / AngularSpacing);
 }
 
-TSet<int32> UWheelLayoutStrategy::ComputeDesiredGlobalIndices()
+int32 UWheelLayoutStrategy::GetGlobalIndexDistance(const int32 GlobalIndexA, const int32 GlobalIndexB) const
+{
+	const int32 Distance = FMath::Abs(GlobalIndexA - GlobalIndexB);
+	if (RadialSegmentCount <= 0)
+	{
+		return Distance;
+	}
+
+	// Segments wrap around, so measure the shorter way
+	const int32 WrappedDistance = Distance % RadialSegmentCount;
+	return FMath::Min(WrappedDistance, RadialSegmentCount - WrappedDistance);
+}
+
+FInt32Range UWheelLayoutStrategy::ComputeDesiredGlobalIndexRange()
 {
 	// Wheel layout has no concept of a "visible window" since all items are always visible
 	VisibleStartIndex = 0;
 	VisibleEndIndex = RadialSegmentCount - 1;
-	
-	TSet<int32> Indices;
-	Indices.Reserve(RadialSegmentCount);
 
-	const int32 EndIndex = RadialSegmentCount;
-	for (int32 i = VisibleStartIndex; i < EndIndex; ++i)
-	{
-		Indices.Add(i);
-	}
-	return Indices;
+	return FInt32Range(VisibleStartIndex, VisibleEndIndex + 1);
 }
 
 //--------------------------------------------------------------------------
@@ -108,3 +158,40 @@ float UWheelLayoutStrategy::CalculateDistanceFactorForGlobalIndex(const int32 Gl
 	constexpr float DistanceFactor = 0.5f;
 	return DistanceFactor;
 }
+
+TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> UWheelLayoutStrategy::MakeLayoutSnapshot(const float InPointerAngle) const
+{
+	// Evenly spaced segments at BaseRadius, all at the pointer's depth: exactly the default snapshot
+	TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FRadialLayoutSnapshot, ESPMode::ThreadSafe>();
+	FillLayoutSnapshot(*Snapshot, InPointerAngle);
+	return Snapshot;
+}
+
+void UWheelLayoutStrategy::UpdatePositionTable() const
+{
+	const int32 SegmentCount = FMath::Max(RadialSegmentCount, 0);
+	if (CachedSegmentCount == SegmentCount && CachedBaseRadius == BaseRadius && CachedAngularSpacing == AngularSpacing)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TArray<float, TInlineAllocator<MAX_ENTRY_COUNT>> AnglesDegrees;
+	TArray<float, TInlineAllocator<MAX_ENTRY_COUNT>> Radii;
+	AnglesDegrees.SetNumUninitialized(SegmentCount);
+	Radii.SetNumUninitialized(SegmentCount);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentCount; ++SegmentIndex)
+	{
+		AnglesDegrees[SegmentIndex] = static_cast<float>(SegmentIndex) * AngularSpacing;
+		Radii[SegmentIndex] = BaseRadius;
+	}
+
+	CachedSegmentPositions.SetNumUninitialized(SegmentCount);
+	ComputePolarPositions(AnglesDegrees, Radii, CachedSegmentPositions);
+
+	CachedSegmentCount = SegmentCount;
+	CachedBaseRadius = BaseRadius;
+	CachedAngularSpacing = AngularSpacing;
+}
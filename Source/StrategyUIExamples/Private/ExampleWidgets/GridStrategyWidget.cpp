@@ -0,0 +1,359 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "ExampleWidgets/GridStrategyWidget.h"
+
+#include <Editor/WidgetCompilerLog.h>
+
+#include <Utils/LogStrategyUI.h>
+
+#include "ExampleStrategies/GridLayoutStrategy.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GridStrategyWidget)
+
+#if WITH_EDITOR
+void UGridStrategyWidget::ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const
+{
+	Super::ValidateCompiledDefaults(CompileLog);
+
+	const UGridLayoutStrategy* GridLayout = Cast<UGridLayoutStrategy>(LayoutStrategy);
+	if (!GridLayout)
+	{
+		CompileLog.Error(FText::FromString(TEXT("Please assign a UGridLayoutStrategy in the details panel!")));
+	}
+}
+#endif
+
+#pragma region BaseStrategyWidget API Overrides
+void UGridStrategyWidget::Reset()
+{
+	StopInertialScrolling();
+	bIsDragScrolling = false;
+	PendingDragScroll = 0.f;
+	if (LayoutStrategy)
+	{
+		UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+		GridLayout.SetFocusedGlobalIndex(INDEX_NONE);
+		SetScrollOffset_Internal(0.f);
+	}
+	bLayoutDirty = true;
+	Super::Reset();
+}
+
+void UGridStrategyWidget::UpdateWidgets()
+{
+	// Refresh the visible rows for the current scroll offset (O(1)) so focus resolves against what's in view now
+	GetLayoutStrategyChecked<UGridLayoutStrategy>().ComputeDesiredGlobalIndexRange();
+	UpdateFocusIndex();
+	Super::UpdateWidgets();
+}
+
+void UGridStrategyWidget::SetItems_Internal_Implementation(const TArray<UObject*>& InItems)
+{
+	Super::SetItems_Internal_Implementation(InItems);
+
+	StopInertialScrolling();
+	GetLayoutStrategyChecked<UGridLayoutStrategy>().SetFocusedGlobalIndex(INDEX_NONE);
+	SetScrollOffset_Internal(0.f);
+	bLayoutDirty = true;
+}
+
+void UGridStrategyWidget::OnDataProviderDelta(const FStrategyDataProviderDelta& Delta)
+{
+	Super::OnDataProviderDelta(Delta);
+
+	// Unlike SetItems, the scroll offset and its momentum are kept (the strategy clamps it to the new item count)
+	bLayoutDirty = true;
+}
+#pragma endregion
+
+
+#pragma region GridStrategyWidget API
+void UGridStrategyWidget::HandleScrollInput(const float Delta)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (FMath::IsNearlyZero(Delta) || !LayoutStrategy)
+	{
+		return;
+	}
+
+	if (bUseInertialScrolling && !bIsDragScrolling)
+	{
+		// Velocity decays exponentially, so coasting to rest covers Velocity / Friction
+		ScrollVelocity += Delta * InertialScrollFriction;
+		return;
+	}
+
+	StopInertialScrolling();
+	AddScrollOffset_Internal(Delta);
+}
+
+void UGridStrategyWidget::HandleStickInput(const FVector2D& Delta)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const UWorld* World = GetWorld();
+	if (!World || !LayoutStrategy)
+	{
+		return;
+	}
+
+	const float AxisInput = FMath::Clamp(GetScrollAxisComponent(Delta), -1.f, 1.f);
+	if (FMath::IsNearlyZero(AxisInput))
+	{
+		return; // No movement, skip
+	}
+
+	StopInertialScrolling();
+	AddScrollOffset_Internal(AxisInput * StickScrollSpeed * World->GetDeltaSeconds());
+}
+
+void UGridStrategyWidget::StepFocus(const int32 DeltaColumns, const int32 DeltaRows)
+{
+	if (!LayoutStrategy || GetItemCount() <= 0)
+	{
+		return;
+	}
+
+	UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+	const int32 CurrentIndex = (FocusedGlobalIndex != INDEX_NONE) ? FocusedGlobalIndex : GridLayout.FindFocusedGlobalIndex();
+	const int32 TargetIndex = GridLayout.GetNeighbourGlobalIndex(FMath::Max(CurrentIndex, 0), DeltaColumns, DeltaRows);
+
+	GridLayout.SetFocusedGlobalIndex(TargetIndex);
+	StopInertialScrolling();
+	SetScrollOffset_Internal(GridLayout.GetScrollOffsetToBringIntoView(TargetIndex));
+	bLayoutDirty = true;
+}
+
+void UGridStrategyWidget::ScrollToItem(const int32 DataIndex)
+{
+	if (!Items.IsValidIndex(DataIndex) || !LayoutStrategy)
+	{
+		return;
+	}
+
+	// Grid global indices map 1:1 to data indices
+	UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+	GridLayout.SetFocusedGlobalIndex(DataIndex);
+	StopInertialScrolling();
+	SetScrollOffset_Internal(GridLayout.GetScrollOffsetToBringIntoView(DataIndex));
+	bLayoutDirty = true;
+}
+
+void UGridStrategyWidget::SetScrollOffset(const float InScrollOffset)
+{
+	if (!LayoutStrategy)
+	{
+		return;
+	}
+
+	StopInertialScrolling();
+	SetScrollOffset_Internal(InScrollOffset);
+}
+
+void UGridStrategyWidget::StopInertialScrolling()
+{
+	ScrollVelocity = 0.f;
+}
+
+float UGridStrategyWidget::GetScrollOffset() const
+{
+	return LayoutStrategy ? GetLayoutStrategyChecked<UGridLayoutStrategy>().GetScrollOffset() : 0.f;
+}
+#pragma endregion
+
+
+#pragma region UUserWidget & UWidget Overrides
+void UGridStrategyWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (!ensureMsgf(LayoutStrategy, TEXT("No LayoutStrategy assigned!")))
+	{
+		return;
+	}
+
+	// The viewport decides how many rows (and auto columns) fit
+	UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+	if (MyGeometry.GetLocalSize() != GridLayout.GetViewportSize())
+	{
+		const float PreviousScrollOffset = GridLayout.GetScrollOffset();
+		GridLayout.SetViewportSize(MyGeometry.GetLocalSize());
+		if (GridLayout.GetScrollOffset() != PreviousScrollOffset)
+		{
+			OnScrollOffsetUpdated.Broadcast(GridLayout.GetScrollOffset(), GridLayout.GetMaxScrollOffset());
+		}
+		bLayoutDirty = true;
+	}
+
+	UpdateInertialScrolling(InDeltaTime);
+
+	if (!bLayoutDirty)
+	{
+		return;
+	}
+	bLayoutDirty = false;
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Updating widgets for scroll offset %.1f"), __FUNCTION__, GridLayout.GetScrollOffset());
+	UpdateWidgets();
+}
+
+FReply UGridStrategyWidget::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (!LayoutStrategy)
+	{
+		return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+	}
+
+	// Wheel up scrolls back toward the start
+	const float NotchAmount = (WheelScrollAmount > 0.f) ? WheelScrollAmount : GetLayoutStrategyChecked<UGridLayoutStrategy>().GetRowPitch();
+	HandleScrollInput(-InMouseEvent.GetWheelDelta() * NotchAmount);
+	return FReply::Handled();
+}
+
+FReply UGridStrategyWidget::NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	const bool bIsDragButton = InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton || InMouseEvent.IsTouchEvent();
+	if (!bAllowDragScrolling || !bIsDragButton || !LayoutStrategy)
+	{
+		return Super::NativeOnMouseButtonDown(InGeometry, InMouseEvent);
+	}
+
+	bIsDragScrolling = true;
+	PendingDragScroll = 0.f;
+	StopInertialScrolling();
+	LastDragPosition = InGeometry.AbsoluteToLocal(InMouseEvent.GetScreenSpacePosition());
+	return FReply::Handled().CaptureMouse(TakeWidget());
+}
+
+FReply UGridStrategyWidget::NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (!bIsDragScrolling || !HasMouseCapture())
+	{
+		return Super::NativeOnMouseMove(InGeometry, InMouseEvent);
+	}
+
+	// Content follows the pointer, so dragging up scrolls toward the end
+	const FVector2D DragPosition = InGeometry.AbsoluteToLocal(InMouseEvent.GetScreenSpacePosition());
+	const float DragDelta = GetScrollAxisComponent(LastDragPosition - DragPosition);
+	LastDragPosition = DragPosition;
+
+	PendingDragScroll += DragDelta;
+	AddScrollOffset_Internal(DragDelta);
+	return FReply::Handled();
+}
+
+FReply UGridStrategyWidget::NativeOnMouseButtonUp(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (!bIsDragScrolling)
+	{
+		return Super::NativeOnMouseButtonUp(InGeometry, InMouseEvent);
+	}
+
+	// Let go: inertia carries on with the tracked drag velocity
+	bIsDragScrolling = false;
+	if (!bUseInertialScrolling)
+	{
+		StopInertialScrolling();
+	}
+	return FReply::Handled().ReleaseMouseCapture();
+}
+
+void UGridStrategyWidget::NativeOnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent)
+{
+	Super::NativeOnMouseCaptureLost(CaptureLostEvent);
+
+	bIsDragScrolling = false;
+	PendingDragScroll = 0.f;
+}
+#pragma endregion
+
+
+#pragma region UGridStrategyWidget Functions - Scrolling
+void UGridStrategyWidget::AddScrollOffset_Internal(const float Delta)
+{
+	if (FMath::IsNearlyZero(Delta))
+	{
+		return;
+	}
+
+	const float RequestedOffset = GetLayoutStrategyChecked<UGridLayoutStrategy>().GetScrollOffset() + Delta;
+	SetScrollOffset_Internal(RequestedOffset);
+
+	// Hit either end, nothing left to coast into
+	if (GetLayoutStrategyChecked<UGridLayoutStrategy>().GetScrollOffset() != RequestedOffset && !bIsDragScrolling)
+	{
+		StopInertialScrolling();
+	}
+}
+
+void UGridStrategyWidget::SetScrollOffset_Internal(const float InScrollOffset)
+{
+	UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+	const float PreviousScrollOffset = GridLayout.GetScrollOffset();
+	const float NewScrollOffset = GridLayout.SetScrollOffset(InScrollOffset);
+	if (NewScrollOffset == PreviousScrollOffset)
+	{
+		return;
+	}
+
+	bLayoutDirty = true;
+	OnScrollOffsetUpdated.Broadcast(NewScrollOffset, GridLayout.GetMaxScrollOffset());
+}
+
+void UGridStrategyWidget::UpdateInertialScrolling(const float InDeltaTime)
+{
+	if (InDeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	if (bIsDragScrolling)
+	{
+		// Track how fast the drag is going, so releasing it coasts at that speed
+		constexpr float DragVelocitySmoothingRate = 12.f;
+		const float Alpha = 1.f - FMath::Exp(-DragVelocitySmoothingRate * InDeltaTime);
+		ScrollVelocity = FMath::Lerp(ScrollVelocity, PendingDragScroll / InDeltaTime, Alpha);
+		PendingDragScroll = 0.f;
+		return;
+	}
+
+	if (!bUseInertialScrolling || ScrollVelocity == 0.f)
+	{
+		return;
+	}
+
+	ScrollVelocity = FMath::Clamp(ScrollVelocity, -MaxInertialScrollSpeed, MaxInertialScrollSpeed);
+
+	// Integrate the exponential decay exactly, so the distance coasted doesn't depend on the frame rate
+	const float Decay = FMath::Exp(-InertialScrollFriction * InDeltaTime);
+	const float Distance = ScrollVelocity * (1.f - Decay) / InertialScrollFriction;
+	ScrollVelocity *= Decay;
+
+	// Snap the tail of the decay to rest
+	constexpr float RestScrollSpeed = 5.f;
+	if (FMath::Abs(ScrollVelocity) < RestScrollSpeed)
+	{
+		ScrollVelocity = 0.f;
+	}
+
+	AddScrollOffset_Internal(Distance);
+}
+
+float UGridStrategyWidget::GetScrollAxisComponent(const FVector2D& InVector) const
+{
+	const bool bVertical = !LayoutStrategy || GetLayoutStrategyChecked<UGridLayoutStrategy>().Orientation == EGridLayoutOrientation::Vertical;
+	return bVertical ? InVector.Y : InVector.X;
+}
+
+void UGridStrategyWidget::UpdateFocusIndex()
+{
+	// Focus follows the content when scrolled out of view (see UGridLayoutStrategy::FindFocusedGlobalIndex)
+	UGridLayoutStrategy& GridLayout = GetLayoutStrategyChecked<UGridLayoutStrategy>();
+	const int32 NewGlobalFocusIndex = GridLayout.FindFocusedGlobalIndex();
+	GridLayout.SetFocusedGlobalIndex(NewGlobalFocusIndex);
+	UpdateFocusedIndex(NewGlobalFocusIndex);
+}
+#pragma endregion
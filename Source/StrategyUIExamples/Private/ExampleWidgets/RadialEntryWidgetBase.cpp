@@ -0,0 +1,38 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "ExampleWidgets/RadialEntryWidgetBase.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(RadialEntryWidgetBase)
+
+void URadialEntryWidgetBase::NativeSetRadialItemMaterialData(const FRadialItemMaterialData& InMaterialData)
+{
+	if (ImplementsSetMaterialDataInBlueprint())
+	{
+		IRadialItemEntry::Execute_BP_SetRadialItemMaterialData(this, InMaterialData);
+	}
+}
+
+UMaterialInstanceDynamic* URadialEntryWidgetBase::NativeGetRadialItemDynamicMaterial() const
+{
+	ResolveBlueprintRadialEvents();
+	return bImplementsGetDynamicMaterialInBlueprint ? IRadialItemEntry::Execute_BP_GetRadialItemDynamicMaterial(this) : nullptr;
+}
+
+bool URadialEntryWidgetBase::ImplementsSetMaterialDataInBlueprint() const
+{
+	ResolveBlueprintRadialEvents();
+	return bImplementsSetMaterialDataInBlueprint;
+}
+
+void URadialEntryWidgetBase::ResolveBlueprintRadialEvents() const
+{
+	if (bHasResolvedBlueprintRadialEvents)
+	{
+		return;
+	}
+
+	const UClass* Class = GetClass();
+	bImplementsSetMaterialDataInBlueprint = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IRadialItemEntry, BP_SetRadialItemMaterialData));
+	bImplementsGetDynamicMaterialInBlueprint = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IRadialItemEntry, BP_GetRadialItemDynamicMaterial));
+	bHasResolvedBlueprintRadialEvents = true;
+}
@@ -2,9 +2,11 @@
 
 #include "ExampleWidgets/RadialStrategyWidget.h"
 
+#include <Async/ParallelFor.h>
 #include <Blueprint/WidgetTree.h>
 #include <Editor/WidgetCompilerLog.h>
 #include <Fonts/SlateFontInfo.h>
+#include <Materials/MaterialInstanceDynamic.h>
 #include <Styling/CoreStyle.h>
 
 #include <Interfaces/IStrategyEntryBase.h>
@@ -14,9 +16,29 @@
 #include <Utils/StrategyUIGameplayTags.h>
 
 #include "ExampleInterfaces/IRadialItemEntry.h"
+#include "ExampleWidgets/RadialEntryWidgetBase.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RadialStrategyWidget)
 
+void FRadialItemMaterialData::ApplyToMaterial(UMaterialInstanceDynamic& Material) const
+{
+	static const FName UVCenterXName(TEXT("UVCenterX"));
+	static const FName UVCenterYName(TEXT("UVCenterY"));
+	static const FName WedgeWidthName(TEXT("WedgeWidth"));
+	static const FName AngleOffsetName(TEXT("AngleOffset"));
+	static const FName SpiralMinRadiusName(TEXT("SpiralMinRadius"));
+	static const FName SpiralMaxRadiusName(TEXT("SpiralMaxRadius"));
+	static const FName DistanceFactorName(TEXT("DistanceFactor"));
+
+	Material.SetScalarParameterValue(UVCenterXName, UVCenterX);
+	Material.SetScalarParameterValue(UVCenterYName, UVCenterY);
+	Material.SetScalarParameterValue(WedgeWidthName, WedgeWidth);
+	Material.SetScalarParameterValue(AngleOffsetName, AngleOffset);
+	Material.SetScalarParameterValue(SpiralMinRadiusName, SpiralMinRadius);
+	Material.SetScalarParameterValue(SpiralMaxRadiusName, SpiralMaxRadius);
+	Material.SetScalarParameterValue(DistanceFactorName, DistanceFactor);
+}
+
 #if WITH_EDITOR
 void URadialStrategyWidget::ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const
 {
@@ -35,6 +57,10 @@ void URadialStrategyWidget::Reset()
 {
 	ResetInput();
 	bAreChildrenReady = false;
+	EntryMaterialCache.Reset();
+	EntrySettleTicksRemaining = 0;
+	ResetLayoutJobs();
+	MarkDirty(ERadialWidgetDirtyFlags::All);
 	Super::Reset();
 }
 
@@ -46,7 +72,9 @@ void URadialStrategyWidget::UpdateEntryWidget(const int32 InGlobalIndex)
 
 void URadialStrategyWidget::UpdateWidgets()
 {
-	GetLayoutStrategyChecked<URadialLayoutStrategy>().SetPointerAngle(CurrentPointerAngle);
+	// Off the game thread, what's shown is the pass computed for the previous refresh's pointer angle
+	const float ShownPointerAngle = (bComputeLayoutOffGameThread && PresentedLayoutJob.IsValid()) ? PresentedLayoutJob->PointerAngle : CurrentPointerAngle;
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().SetPointerAngle(ShownPointerAngle);
 	UpdateFocusIndex();
 	Super::UpdateWidgets();
 }
@@ -55,7 +83,41 @@ void URadialStrategyWidget::SetItems_Internal_Implementation(const TArray<UObjec
 {
 	Super::SetItems_Internal_Implementation(InItems);
 
+	ResetLayoutJobs();
 	ResetInput();
+	MarkDirty(ERadialWidgetDirtyFlags::Items);
+}
+
+void URadialStrategyWidget::OnDataProviderDelta(const FStrategyDataProviderDelta& Delta)
+{
+	Super::OnDataProviderDelta(Delta);
+
+	// Unlike SetItems, the pointer and its momentum are kept. Passes computed for the old items are not.
+	ResetLayoutJobs();
+	MarkDirty(ERadialWidgetDirtyFlags::Items);
+}
+
+void URadialStrategyWidget::OnAsyncWidgetLoadBatchCompleted_Implementation(const TArray<int32>& LoadedGlobalIndices)
+{
+	Super::OnAsyncWidgetLoadBatchCompleted_Implementation(LoadedGlobalIndices);
+
+	// Freshly loaded entries only get a desired size after their first prepass, so keep refreshing for a couple of
+	// ticks to push their material data once it's meaningful.
+	EntrySettleTicksRemaining = 2;
+	MarkDirty(ERadialWidgetDirtyFlags::EntryLoading);
+}
+
+bool URadialStrategyWidget::GetPrecomputedItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const
+{
+	const FRadialLayoutJob* Job = GetPresentedLayoutJob();
+	if (!Job || Job->WindowRange != GlobalIndexRange)
+	{
+		return false;
+	}
+
+	const int32 Count = FMath::Min(Job->Positions.Num(), OutPositions.Num());
+	FMemory::Memcpy(OutPositions.GetData(), Job->Positions.GetData(), Count * sizeof(FVector2D));
+	return true;
 }
 #pragma endregion
 
@@ -85,7 +147,7 @@ void URadialStrategyWidget::HandleStickInput(const FVector2D& Delta)
 	const FVector2D NormalizedDelta = Delta.GetSafeNormal();
 
 	// Compute the pointer's current position in 2D space
-	const float PointerAngleRad = FMath::DegreesToRadians(CurrentPointerAngle);
+	const float PointerAngleRad = FMath::DegreesToRadians(GetInputPointerAngle());
 	const FVector2D PointerPosition(
 		FMath::Cos(PointerAngleRad),
 		FMath::Sin(PointerAngleRad)
@@ -99,6 +161,7 @@ void URadialStrategyWidget::HandleStickInput(const FVector2D& Delta)
 	const float RotationDeltaDegrees = TangentialDelta * RotationSensitivity * World->GetDeltaSeconds();
 
 	// Apply the calculated rotation delta
+	PendingInputRotationDegrees += RotationDeltaDegrees;
 	ApplyManualRotation(RotationDeltaDegrees);
 }
 
@@ -137,14 +200,15 @@ void URadialStrategyWidget::HandleMouseInput(const FVector2D& InMouseScreenPos)
 	const float NewAtan2Angle = FMath::RadiansToDegrees(FMath::Atan2(ToMouse.Y, ToMouse.X));
 
 	// 4) Derive "last frame's angle" in [–180..180] by wrapping our unbounded pointer angle
-	const float CurrentAngleWrapped = WrapAngleToPlusMinus180(CurrentPointerAngle);
+	const float CurrentAngleWrapped = WrapAngleToPlusMinus180(GetInputPointerAngle());
 
 	// 5) Compute the actual delta in [–180..180]
 	const float DeltaAngle = FMath::FindDeltaAngleDegrees(CurrentAngleWrapped, NewAtan2Angle);
 
 	// 6) Accumulate into our unbounded pointer angle
-	const float WorkingAngle = CurrentPointerAngle + DeltaAngle;
-	SetCurrentAngle(WorkingAngle);
+	PendingInputRotationDegrees += DeltaAngle;
+	const float WorkingAngle = GetInputPointerAngle() + DeltaAngle;
+	QueueInputAngle(WorkingAngle);
 }
 
 void URadialStrategyWidget::ResetInput()
@@ -152,6 +216,9 @@ void URadialStrategyWidget::ResetInput()
 	// @TODO: Consider a better cleanup and init flow in case new data comes in at runtime and we need to reset the layout
 
 	RuntimeScrollingAnimState.bIsAnimating = false;
+	PendingInputRotationDegrees = 0.f;
+	PointerAngularVelocity = 0.f;
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().SetPointerAngularVelocity(0.f);
 	SetCurrentAngle(0.0f);
 	UpdateFocusedIndex(INDEX_NONE);
 }
@@ -255,6 +322,11 @@ void URadialStrategyWidget::NativeTick(const FGeometry& MyGeometry, float InDelt
 		return;
 	}
 
+	// All input since the last tick lands here, once
+	FlushQueuedInputAngle();
+
+	UpdatePointerAngularVelocity(InDeltaTime);
+
 	// If we have an animation in progress, advance it
 	if (RuntimeScrollingAnimState.bIsAnimating)
 	{
@@ -273,20 +345,38 @@ void URadialStrategyWidget::NativeTick(const FGeometry& MyGeometry, float InDelt
 		// We can swap to e.g. InterpEaseInOut or InterpSinInOut easily.
 		const float AnimAngle = FMath::Lerp(RuntimeScrollingAnimState.StartAngle, RuntimeScrollingAnimState.EndAngle, Alpha);
 		SetCurrentAngle(AnimAngle);
-		UpdateWidgets();
+		DirtyFlags = ERadialWidgetDirtyFlags::None;
+		RefreshLayout(ERadialWidgetDirtyFlags::PointerAngle);
 		return;
 	}
-	
-	static float LastInputAngle = FLT_MAX;
-	if (CurrentPointerAngle == LastInputAngle && bAreChildrenReady)
+
+	// Keep refreshing until entries have loaded and reported a size, otherwise their material data would stay stale
+	if (!bAreChildrenReady || PendingRequests.Num() > 0 || EntrySettleTicksRemaining > 0)
+	{
+		EntrySettleTicksRemaining = FMath::Max(EntrySettleTicksRemaining - 1, 0);
+		DirtyFlags |= ERadialWidgetDirtyFlags::EntryLoading;
+	}
+
+	// A pass computed off the game thread still has to be presented
+	if (PendingLayoutTask.IsValid())
+	{
+		DirtyFlags |= ERadialWidgetDirtyFlags::LayoutJob;
+	}
+
+	if (DirtyFlags == ERadialWidgetDirtyFlags::None)
 	{
-		// Avoid updating the layout if the angle hasn't changed, improving idle performance
+		// Nothing changed since the last refresh; stop ticking until input or new data wakes us up
+		if (bSleepWhenIdle)
+		{
+			SetSleeping(true);
+		}
 		return;
 	}
-	LastInputAngle = CurrentPointerAngle;
+	const ERadialWidgetDirtyFlags RefreshReasons = DirtyFlags;
+	DirtyFlags = ERadialWidgetDirtyFlags::None;
 
 	UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: Updating widgets for angle %.1f"),__FUNCTION__, CurrentPointerAngle);
-	UpdateWidgets();
+	RefreshLayout(RefreshReasons);
 }
 
 int32 URadialStrategyWidget::NativePaint(
@@ -301,6 +391,13 @@ int32 URadialStrategyWidget::NativePaint(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 
+	// Paint still runs while asleep, so this is where a resize gets noticed
+	if (AllottedGeometry.GetLocalSize() != LastPaintedGeometrySize)
+	{
+		LastPaintedGeometrySize = AllottedGeometry.GetLocalSize();
+		MarkDirty(ERadialWidgetDirtyFlags::Geometry);
+	}
+
 	const int32 MaxLayer = Super::NativePaint(
 		Args,
 		AllottedGeometry,
@@ -322,6 +419,33 @@ int32 URadialStrategyWidget::NativePaint(
 	
 	return MaxLayer;
 }
+
+void URadialStrategyWidget::ReleaseEntryWidget(const int32 GlobalIndex)
+{
+	if (const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(GlobalIndex))
+	{
+		if (const UUserWidget* Widget = SlotData->Widget.Get())
+		{
+			EntryMaterialCache.Remove(Widget);
+		}
+	}
+	Super::ReleaseEntryWidget(GlobalIndex);
+}
+
+void URadialStrategyWidget::Hibernate()
+{
+	// Don't leave a pass running while nobody is around to present it
+	ResetLayoutJobs();
+	Super::Hibernate();
+}
+
+void URadialStrategyWidget::WakeFromHibernation()
+{
+	// The rebuilt Slate widget ticks by default, and its size may differ from the last paint
+	bIsSleeping = false;
+	MarkDirty(ERadialWidgetDirtyFlags::Geometry | ERadialWidgetDirtyFlags::PointerAngle);
+	Super::WakeFromHibernation();
+}
 #pragma endregion
 
 
@@ -331,17 +455,32 @@ int32 URadialStrategyWidget::NativePaint(
 void URadialStrategyWidget::DrawItemDebugInfo(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId) const
 {
 	// How many data items we want to see around the visible window
-	const int32 NumDeactivatedEntries = GetLayoutStrategyChecked<URadialLayoutStrategy>().NumDeactivatedEntries;
+	int32 LowerMargin = 0;
+	int32 UpperMargin = 0;
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().GetDeactivatedMargins(LowerMargin, UpperMargin);
 
-	TSet<int32> DesiredIndices = GetLayoutStrategyChecked<URadialLayoutStrategy>().ComputeDesiredGlobalIndices();
+	// Refreshes the visible window
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().ComputeDesiredGlobalIndexRange();
 	
 	const int32 VisibleStartIndex = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetVisibleStartIndex();
 	const int32 VisibleEndIndex = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetVisibleEndIndex();
-	const int32 DebugStart = VisibleStartIndex - NumDeactivatedEntries;
-	const int32 DebugEnd   = VisibleEndIndex + NumDeactivatedEntries;
+	const int32 DebugStart = VisibleStartIndex - LowerMargin;
+	const int32 DebugEnd   = VisibleEndIndex + UpperMargin;
+
+	// Evaluate the whole debug window at once
+	const FInt32Range DebugRange(DebugStart, DebugEnd + 1);
+	const int32 DebugCount = FMath::Max(DebugRange.Size<int32>(), 0);
+	TArray<FVector2D> LocalPositions;
+	TArray<float> ItemAnglesDeg;
+	LocalPositions.SetNumUninitialized(DebugCount);
+	ItemAnglesDeg.SetNumUninitialized(DebugCount);
+	GetLayoutStrategyChecked().ComputeItemPositions(DebugRange, LocalPositions);
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().ComputeItemAnglesDegrees(DebugRange, ItemAnglesDeg);
 
 	for (int32 GlobalIndex = DebugStart; GlobalIndex <= DebugEnd; ++GlobalIndex)
 	{
+		const int32 DebugSlot = GlobalIndex - DebugStart;
+
 		// Check if this global index is actually in the "visible" window
 		const bool bIsVisibleGlobal = (GlobalIndex >= VisibleStartIndex && GlobalIndex <= VisibleEndIndex);
 			
@@ -357,12 +496,12 @@ void URadialStrategyWidget::DrawItemDebugInfo(const FGeometry& AllottedGeometry,
 		// Draw debug item text
 		{
 			// Compute angles and positions
-			const float ItemAngleDeg = GetLayoutStrategyChecked<URadialLayoutStrategy>().CalculateItemAngleDegreesForGlobalIndex(GlobalIndex);
+			const float ItemAngleDeg = ItemAnglesDeg[DebugSlot];
 			const float OffsetAngle  = ItemAngleDeg - CurrentPointerAngle;
 			const float UnwoundAngle = FMath::UnwindDegrees(OffsetAngle);
 			
-			const FVector2D LocalPos = GetLayoutStrategyChecked().GetItemPosition(GlobalIndex);
-			const float Radius = GetLayoutStrategyChecked<URadialLayoutStrategy>().CalculateRadiusForGlobalIndex(GlobalIndex);
+			const FVector2D LocalPos = LocalPositions[DebugSlot];
+			const float Radius = LocalPos.Size();
 
 			FString DebugString = FString::Printf(
 				TEXT("\nG=%d | D=%d\nAng=%.1f\nOff=%.1f\nRadius=%.1f, LocalPos=%s"),
@@ -415,19 +554,55 @@ void URadialStrategyWidget::DrawItemDebugInfo(const FGeometry& AllottedGeometry,
 #pragma region URadialStrategyWidget Functions - Rotation Handling
 void URadialStrategyWidget::SetCurrentAngle(const float InNewAngle)
 {
+	if (InNewAngle != CurrentPointerAngle)
+	{
+		MarkDirty(ERadialWidgetDirtyFlags::PointerAngle);
+	}
 	CurrentPointerAngle = InNewAngle;
+	bHasQueuedInputAngle = false; // Supersedes any queued input
 
 	GetLayoutStrategyChecked<URadialLayoutStrategy>().SetPointerAngle(CurrentPointerAngle);
+	BroadcastPointerRotationUpdated();
+}
+
+void URadialStrategyWidget::QueueInputAngle(const float InNewAngle)
+{
+	if (InNewAngle == GetInputPointerAngle())
+	{
+		return;
+	}
+
+	// Later input in the same tick builds on this angle (see GetInputPointerAngle)
+	QueuedInputAngle = InNewAngle;
+	bHasQueuedInputAngle = true;
+	MarkDirty(ERadialWidgetDirtyFlags::PointerAngle);
+}
+
+void URadialStrategyWidget::FlushQueuedInputAngle()
+{
+	if (!bHasQueuedInputAngle)
+	{
+		return;
+	}
+	bHasQueuedInputAngle = false;
+
+	// Through the virtual, so subclasses see input like any other angle change
+	SetCurrentAngle(QueuedInputAngle);
+}
 
+void URadialStrategyWidget::BroadcastPointerRotationUpdated() const
+{
 	// Broadcast the new angle in a [-180, 180] degree range for convenience in BP
-	OnPointerRotationUpdated.Broadcast(FMath::UnwindDegrees(CurrentPointerAngle));
+	const float UnwoundAngle = FMath::UnwindDegrees(CurrentPointerAngle);
+	PointerRotationUpdatedNativeDelegate.Broadcast(UnwoundAngle);
+	OnPointerRotationUpdated.Broadcast(UnwoundAngle);
 }
 
 void URadialStrategyWidget::ApplyManualRotation(const float DeltaDegrees)
 {
 	if (!FMath::IsNearlyZero(DeltaDegrees))
 	{
-		SetCurrentAngle(CurrentPointerAngle + DeltaDegrees);
+		QueueInputAngle(GetInputPointerAngle() + DeltaDegrees);
 	}
 }
 
@@ -438,7 +613,8 @@ void URadialStrategyWidget::AddRotation_Internal(const float DeltaDegrees)
 		return;
 	}
 
-	SetCurrentAngle(CurrentPointerAngle += DeltaDegrees);
+	// Builds on input queued this tick, SetCurrentAngle compares against the current angle to mark the pointer dirty
+	SetCurrentAngle(GetInputPointerAngle() + DeltaDegrees);
 }
 
 void URadialStrategyWidget::BeginAngleAnimation(const float InTargetAngle, const float Duration)
@@ -451,15 +627,118 @@ void URadialStrategyWidget::BeginAngleAnimation(const float InTargetAngle, const
 	}
 	else
 	{
+		MarkDirty(ERadialWidgetDirtyFlags::PointerAngle);
 		RuntimeScrollingAnimState.bIsAnimating = true;
 		RuntimeScrollingAnimState.Duration     = Duration;
 		RuntimeScrollingAnimState.ElapsedTime  = 0.f;
-		RuntimeScrollingAnimState.StartAngle   = CurrentPointerAngle;
+		RuntimeScrollingAnimState.StartAngle   = GetInputPointerAngle();
 		RuntimeScrollingAnimState.EndAngle     = InTargetAngle;
-		RuntimeScrollingAnimState.DeltaAngle   = (InTargetAngle - CurrentPointerAngle);
+		RuntimeScrollingAnimState.DeltaAngle   = (InTargetAngle - RuntimeScrollingAnimState.StartAngle);
+
+		PrefetchAngleAnimationPath(RuntimeScrollingAnimState.StartAngle, InTargetAngle);
+	}
+}
+
+void URadialStrategyWidget::PrefetchAngleAnimationPath(const float InStartAngle, const float InEndAngle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!bPrefetchEntryWidgets || !LayoutStrategy)
+	{
+		return;
+	}
+
+	const URadialLayoutStrategy& RadialLayout = GetLayoutStrategyChecked<URadialLayoutStrategy>();
+	const float AngularSpacing = RadialLayout.GetAngularSpacing();
+	if (FMath::IsNearlyZero(AngularSpacing) || FMath::IsNearlyEqual(InStartAngle, InEndAngle))
+	{
+		return;
+	}
+
+	// The range of entries that get real widgets with the pointer at InAngle
+	auto GetFullWidgetRange = [this, &RadialLayout](const float InAngle) -> FInt32Range
+	{
+		const FInt32Range WindowRange = RadialLayout.ComputeDesiredGlobalIndexRangeForAngle(InAngle);
+		if (!bUseEntryProxies)
+		{
+			return WindowRange;
+		}
+		const int32 FocusIndex = RadialLayout.FindGlobalIndexForAngle(InAngle);
+		return FInt32Range::Intersection(
+			WindowRange,
+			FInt32Range(FocusIndex - FullWidgetFocusDistance, FocusIndex + FullWidgetFocusDistance + 1)
+		);
+	};
+
+	// Walk the path one wedge at a time, collecting whatever enters the range at each step. Steps past
+	// MaxPrefetchedEntries can't contribute anything PrefetchEntryWidgets would keep, since each brings in at least one index.
+	const int32 NumSteps = FMath::Min(FMath::CeilToInt(FMath::Abs(InEndAngle - InStartAngle) / AngularSpacing), MaxPrefetchedEntries);
+	const float StepAngle = FMath::Sign(InEndAngle - InStartAngle) * AngularSpacing;
+
+	TArray<int32, TInlineAllocator<64>> PathIndices;
+	FInt32Range PreviousRange = GetFullWidgetRange(InStartAngle);
+	for (int32 Step = 1; Step <= NumSteps; ++Step)
+	{
+		const float SampleAngle = (Step == NumSteps) ? InEndAngle : InStartAngle + StepAngle * Step;
+		const FInt32Range Range = GetFullWidgetRange(SampleAngle);
+		if (Range.IsEmpty() || Range == PreviousRange)
+		{
+			continue;
+		}
+
+		// Ranges slide with the angle, so anything new is past one end of the previous range
+		const bool bHasPrevious = !PreviousRange.IsEmpty();
+		const int32 Lower = Range.GetLowerBoundValue();
+		const int32 Upper = Range.GetUpperBoundValue();
+		for (int32 GlobalIndex = Lower; GlobalIndex < Upper; ++GlobalIndex)
+		{
+			if (bHasPrevious && PreviousRange.Contains(GlobalIndex))
+			{
+				GlobalIndex = PreviousRange.GetUpperBoundValue() - 1; // Skip over the overlap
+				continue;
+			}
+			PathIndices.AddUnique(GlobalIndex); // Wheels wrap, so a long spin can come back around
+		}
+		PreviousRange = Range;
+	}
+
+	if (!PathIndices.IsEmpty())
+	{
+		PrefetchEntryWidgets(PathIndices);
 	}
 }
 
+void URadialStrategyWidget::UpdatePointerAngularVelocity(const float InDeltaTime)
+{
+	if (InDeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	const float InputVelocity = PendingInputRotationDegrees / InDeltaTime;
+	PendingInputRotationDegrees = 0.f;
+
+	// Frame-rate independent exponential smoothing; with no input this decays back to rest
+	const float Alpha = 1.f - FMath::Exp(-PointerVelocitySmoothingRate * InDeltaTime);
+	float NewVelocity = FMath::Lerp(PointerAngularVelocity, InputVelocity, Alpha);
+
+	// Snap the tail of the decay to rest so the widget can go back to sleep
+	constexpr float RestVelocityDegreesPerSecond = 1.f;
+	if (FMath::Abs(NewVelocity) < RestVelocityDegreesPerSecond)
+	{
+		NewVelocity = 0.f;
+	}
+
+	if (NewVelocity == PointerAngularVelocity)
+	{
+		return;
+	}
+
+	PointerAngularVelocity = NewVelocity;
+	GetLayoutStrategyChecked<URadialLayoutStrategy>().SetPointerAngularVelocity(PointerAngularVelocity);
+	DirtyFlags |= ERadialWidgetDirtyFlags::PointerVelocity;
+}
+
 float URadialStrategyWidget::ScaleDurationByGapItems(const float InitialDuration) const
 {
 	const int32 NumGapItems = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetGapSegments();
@@ -468,6 +747,218 @@ float URadialStrategyWidget::ScaleDurationByGapItems(const float InitialDuration
 }
 #pragma endregion
 
+#pragma region URadialStrategyWidget Functions - Idle Sleep
+void URadialStrategyWidget::MarkDirty(const ERadialWidgetDirtyFlags InFlags) const
+{
+	DirtyFlags |= InFlags;
+	SetSleeping(false);
+}
+
+void URadialStrategyWidget::SetSleeping(const bool bInSleeping) const
+{
+	if (bIsSleeping == bInSleeping)
+	{
+		return;
+	}
+
+	// The cached widget is our SObjectWidget; if it doesn't exist yet, a freshly built one ticks by default anyway
+	const TSharedPtr<SWidget> CachedWidget = GetCachedWidget();
+	if (!CachedWidget.IsValid())
+	{
+		bIsSleeping = false;
+		return;
+	}
+
+	bIsSleeping = bInSleeping;
+	CachedWidget->SetCanTick(!bInSleeping);
+
+	UE_LOG(LogStrategyUI, VeryVerbose, TEXT("%hs: %s is now %s"), __FUNCTION__, *GetName(), bInSleeping ? TEXT("asleep") : TEXT("awake"));
+}
+#pragma endregion
+
+#pragma region URadialStrategyWidget Functions - Off Game Thread Layout
+void URadialStrategyWidget::RefreshLayout(const ERadialWidgetDirtyFlags InReasons)
+{
+	if (!bComputeLayoutOffGameThread)
+	{
+		if (PresentedLayoutJob.IsValid() || PendingLayoutTask.IsValid())
+		{
+			ResetLayoutJobs(); // Switched off at runtime
+		}
+		UpdateWidgets();
+		return;
+	}
+
+	CompleteLayoutJob();
+	UpdateWidgets();
+
+	// Presenting was all that was left; the worker already computed the current input
+	if (InReasons != ERadialWidgetDirtyFlags::LayoutJob)
+	{
+		LaunchLayoutJob();
+	}
+}
+
+void URadialStrategyWidget::CompleteLayoutJob()
+{
+	if (!PendingLayoutTask.IsValid())
+	{
+		return;
+	}
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_STR("URadialStrategyWidget::CompleteLayoutJob - Wait");
+		PendingLayoutTask.Wait();
+	}
+	PendingLayoutTask = UE::Tasks::FTask();
+
+	// The finished back buffer becomes the front, the old front gets reused for the next pass
+	Swap(PendingLayoutJob, PresentedLayoutJob);
+}
+
+void URadialStrategyWidget::LaunchLayoutJob()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	check(!PendingLayoutTask.IsValid());
+
+	const URadialLayoutStrategy& RadialLayout = GetLayoutStrategyChecked<URadialLayoutStrategy>();
+	const FInt32Range WindowRange = RadialLayout.ComputeDesiredGlobalIndexRangeForAngle(CurrentPointerAngle);
+	if (WindowRange.IsEmpty())
+	{
+		return;
+	}
+
+	TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> Snapshot = RadialLayout.MakeLayoutSnapshot(CurrentPointerAngle);
+	if (!Snapshot.IsValid())
+	{
+		UE_LOG(LogStrategyUI, Verbose, TEXT("%hs: %s can't be snapshotted, laying out on the game thread"), __FUNCTION__, *RadialLayout.GetName());
+		return;
+	}
+
+	if (!PendingLayoutJob.IsValid())
+	{
+		PendingLayoutJob = MakeShared<FRadialLayoutJob, ESPMode::ThreadSafe>();
+	}
+
+	FRadialLayoutJob& Job = *PendingLayoutJob;
+	Job.Snapshot = MoveTemp(Snapshot);
+	Job.PointerAngle = CurrentPointerAngle;
+	Job.WindowRange = WindowRange;
+	Job.WedgeGapSize = DynamicWedgeGapSize;
+	Job.BatchSize = FMath::Max(LayoutBatchSize, 1);
+
+	// Widget sizes can only be read here; entries without a sized radial widget are left to the game thread
+	const int32 FirstGlobalIndex = WindowRange.GetLowerBoundValue();
+	const int32 Count = WindowRange.Size<int32>();
+	Job.EntrySizes.SetNumUninitialized(Count, EAllowShrinking::No);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FStrategyEntrySlotData* SlotData = GlobalIndexToSlotData.Find(FirstGlobalIndex + i);
+		UUserWidget* Widget = (SlotData && EnumHasAnyFlags(SlotData->EntryState, EStrategyEntryState::Active)) ? SlotData->Widget.Get() : nullptr;
+		Job.EntrySizes[i] = (Widget && GetRadialEntryDispatch(*Widget) != EStrategyEntryDispatch::None) ? Widget->GetDesiredSize() : FVector2D::ZeroVector;
+	}
+
+	// The task only sees the job, never the widget, so it's fine for the widget to go away while it runs
+	PendingLayoutTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job = PendingLayoutJob]()
+	{
+		Job->Execute();
+	});
+}
+
+void URadialStrategyWidget::ResetLayoutJobs()
+{
+	if (PendingLayoutTask.IsValid())
+	{
+		PendingLayoutTask.Wait();
+		PendingLayoutTask = UE::Tasks::FTask();
+	}
+	PresentedLayoutJob.Reset();
+}
+
+const URadialStrategyWidget::FRadialLayoutJob* URadialStrategyWidget::GetPresentedLayoutJob() const
+{
+	if (!bComputeLayoutOffGameThread || !PresentedLayoutJob.IsValid() || !PresentedLayoutJob->Snapshot.IsValid() || !LayoutStrategy)
+	{
+		return nullptr;
+	}
+
+	// Only usable while the strategy is laying out the same angle, e.g. not after SetItems or a jump
+	if (PresentedLayoutJob->Snapshot->PointerAngle != GetLayoutStrategyChecked<URadialLayoutStrategy>().GetPointerAngle())
+	{
+		return nullptr;
+	}
+	return PresentedLayoutJob.Get();
+}
+
+bool URadialStrategyWidget::GetPrecomputedMaterialData(const int32 InGlobalIndex, const UUserWidget& EntryWidget, FRadialItemMaterialData& OutMaterialData) const
+{
+	const FRadialLayoutJob* Job = GetPresentedLayoutJob();
+	if (!Job || !Job->WindowRange.Contains(InGlobalIndex))
+	{
+		return false;
+	}
+
+	// Entries that (re)sized since the pass was launched need fresh data
+	const int32 JobIndex = InGlobalIndex - Job->WindowRange.GetLowerBoundValue();
+	const FVector2D& EntrySize = Job->EntrySizes[JobIndex];
+	if (EntrySize.IsNearlyZero() || EntrySize != EntryWidget.GetDesiredSize())
+	{
+		return false;
+	}
+
+	bAreChildrenReady = true;
+	OutMaterialData = Job->MaterialData[JobIndex];
+	return true;
+}
+
+void URadialStrategyWidget::FRadialLayoutJob::Execute()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const int32 Count = FMath::Max(WindowRange.Size<int32>(), 0);
+	Positions.SetNumUninitialized(Count, EAllowShrinking::No);
+	MaterialData.SetNum(Count, EAllowShrinking::No);
+	if (Count == 0)
+	{
+		return;
+	}
+
+	const FRadialLayoutSnapshot& Layout = *Snapshot;
+	const int32 FirstGlobalIndex = WindowRange.GetLowerBoundValue();
+	const int32 NumBatches = FMath::DivideAndRoundUp(Count, BatchSize);
+	ParallelFor(NumBatches, [this, &Layout, FirstGlobalIndex, Count](const int32 BatchIndex)
+	{
+		const int32 Begin = BatchIndex * BatchSize;
+		const int32 End = FMath::Min(Begin + BatchSize, Count);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const int32 GlobalIndex = FirstGlobalIndex + i;
+			const float ItemAngleDeg = Layout.GetItemAngleDegrees(GlobalIndex);
+
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(ItemAngleDeg));
+			const float Radius = Layout.GetRadius(GlobalIndex);
+			Positions[i] = FVector2D(Radius * Cos, Radius * Sin);
+
+			if (!EntrySizes[i].IsNearlyZero())
+			{
+				MaterialData[i] = ComputeMaterialData(
+					EntrySizes[i],
+					Positions[i],
+					ItemAngleDeg,
+					Layout.AngularSpacing,
+					WedgeGapSize,
+					Layout.GetDistanceFactor(GlobalIndex),
+					Layout.MinRadius,
+					Layout.MaxRadius
+				);
+			}
+		}
+	}, NumBatches > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+#pragma endregion
+
 #pragma region URadialStrategyWidget Functions - Radial Material
 void URadialStrategyWidget::ConstructMaterialData(
 	const UUserWidget* EntryWidget,
@@ -489,14 +980,40 @@ void URadialStrategyWidget::ConstructMaterialData(
 	}
 	bAreChildrenReady = true; // If one widget is ready (aka has a valid size), consider them all ready
 
+	const URadialLayoutStrategy& RadialLayout = GetLayoutStrategyChecked<URadialLayoutStrategy>();
+	const FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindChecked(InGlobalIndex);
+
+	OutMaterialData = ComputeMaterialData(
+		EntrySize,
+		SlotData.Position,
+		RadialLayout.CalculateItemAngleDegreesForGlobalIndex(InGlobalIndex),
+		RadialLayout.GetAngularSpacing(),
+		DynamicWedgeGapSize,
+		RadialLayout.CalculateDistanceFactorForGlobalIndex(InGlobalIndex),
+		RadialLayout.GetMinRadius(),
+		RadialLayout.GetMaxRadius()
+	);
+
+	UE_LOG(LogStrategyUI, Verbose, TEXT("Computed material data for widget %s: %s based on SlotPos %s, EntrySize %s"),
+		*EntryWidget->GetName(), *OutMaterialData.ToString(), *SlotData.Position.ToString(), *EntrySize.ToString());
+}
+
+FRadialItemMaterialData URadialStrategyWidget::ComputeMaterialData(
+	const FVector2D& EntrySize,
+	const FVector2D& SlotPosition,
+	const float ItemAngleDeg,
+	const float AngularSpacing,
+	const float WedgeGapSize,
+	const float DistanceFactor,
+	const float MinRadius,
+	const float MaxRadius
+)
+{
 	// -------------------------------------------------------------------
-	// 2) Compute radial angles
+	// 1) Compute radial angles
 	// -------------------------------------------------------------------
-	const float ItemAngleDeg = GetLayoutStrategyChecked<URadialLayoutStrategy>().CalculateItemAngleDegreesForGlobalIndex(InGlobalIndex);
-
-	const float AngularSpacing = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetAngularSpacing();
-	const float HalfWedge      = AngularSpacing * 0.5f;
-	const float RawStartDeg    = ItemAngleDeg - HalfWedge;
+	const float HalfWedge   = AngularSpacing * 0.5f;
+	const float RawStartDeg = ItemAngleDeg - HalfWedge;
 
 	auto ClampAngle0To360 = [](float A)
 	{
@@ -507,53 +1024,49 @@ void URadialStrategyWidget::ConstructMaterialData(
 	const float StartDeg = ClampAngle0To360(RawStartDeg);
 
 	// Subtract gap from the wedge
-	const float Gap     = DynamicWedgeGapSize; 
-	const float HalfGap = Gap * 0.5f;
+	const float HalfGap = WedgeGapSize * 0.5f;
 	const float GappedStartDeg = StartDeg + HalfGap;
-	const float WedgeWidthDeg  = AngularSpacing - Gap;
+	const float WedgeWidthDeg  = AngularSpacing - WedgeGapSize;
 
-	// Convert angles to [0..1] for the material
-	const float AngleOffsetN = GappedStartDeg / 360.f;
-	const float WedgeWidthN  = WedgeWidthDeg  / 360.f;
-	
 	// -------------------------------------------------------------------
-	// 3) Manually compute the container center in this widget’s local coords
+	// 2) Where the container center lands in the entry's UV space
 	// -------------------------------------------------------------------
-	const FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindChecked(InGlobalIndex);
-
-	const FVector2D& SlotPos = SlotData.Position;
-	// Where does the widget’s top-left corner end up in container coords?
-	const FVector2D WidgetTopLeftInContainer = SlotPos - (EntrySize * 0.5f);
-	const FVector2D& CenterInWidgetLocal = 	Center - WidgetTopLeftInContainer;
-	
-	FVector2D UVCenter = FVector2D(0.5f) - (SlotPos / EntrySize);
+	const FVector2D UVCenter = FVector2D(0.5f) - (SlotPosition / EntrySize);
 
-	UE_LOG(LogStrategyUI, Verbose, TEXT("Computed material data for widget %s: Center=(%.1f, %.1f), UVCenter=(%s), WedgeWidth=%.1f, AngleOffset=%.1f based on SlotPos %s, CenterInWidgetLocal %s, WidgetTopLeftInContainer:%s, EntrySize %s"),
-		*EntryWidget->GetName(), Center.X, Center.Y, *UVCenter.ToString(), WedgeWidthN, AngleOffsetN, *SlotPos.ToString(), *CenterInWidgetLocal.ToString(), *WidgetTopLeftInContainer.ToString(), *EntrySize.ToString());
 	// -------------------------------------------------------------------
-	// 4) Distance factor & radial extents
-	// -------------------------------------------------------------------
-	const float DistanceFactor = GetLayoutStrategyChecked<URadialLayoutStrategy>().CalculateDistanceFactorForGlobalIndex(InGlobalIndex);
-
-	const float MinRadiusPx = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetMinRadius();
-	const float MaxRadiusPx = GetLayoutStrategyChecked<URadialLayoutStrategy>().GetMaxRadius();
-
-	const float SpiralMinRadiusN = MinRadiusPx / EntrySize.X;
-	const float SpiralMaxRadiusN = MaxRadiusPx / EntrySize.X;
-
-	// -------------------------------------------------------------------
-	// 5) Fill in the final material data
+	// 3) Fill in the final material data, angles and radii normalized to [0..1]
 	// -------------------------------------------------------------------
 	FRadialItemMaterialData MatData;
 	MatData.UVCenterX       = UVCenter.X;
 	MatData.UVCenterY       = UVCenter.Y;
-	MatData.WedgeWidth      = WedgeWidthN;
-	MatData.AngleOffset     = AngleOffsetN;
-	MatData.SpiralMinRadius = SpiralMinRadiusN;
-	MatData.SpiralMaxRadius = SpiralMaxRadiusN;
+	MatData.WedgeWidth      = WedgeWidthDeg / 360.f;
+	MatData.AngleOffset     = GappedStartDeg / 360.f;
+	MatData.SpiralMinRadius = MinRadius / EntrySize.X;
+	MatData.SpiralMaxRadius = MaxRadius / EntrySize.X;
 	MatData.DistanceFactor  = DistanceFactor;
+	return MatData;
+}
+
+URadialStrategyWidget::FRadialEntryMaterialCache& URadialStrategyWidget::FindOrAddMaterialCache(UUserWidget& EntryWidget)
+{
+	FRadialEntryMaterialCache& Cache = EntryMaterialCache.FindOrAdd(&EntryWidget);
+	if (Cache.Dispatch == EStrategyEntryDispatch::Unresolved)
+	{
+		if (EntryWidget.IsA<URadialEntryWidgetBase>())
+		{
+			Cache.Dispatch = EStrategyEntryDispatch::Native;
+		}
+		else
+		{
+			Cache.Dispatch = EntryWidget.Implements<URadialItemEntry>() ? EStrategyEntryDispatch::Interface : EStrategyEntryDispatch::None;
+		}
+	}
+	return Cache;
+}
 
-	OutMaterialData = MatData;
+EStrategyEntryDispatch URadialStrategyWidget::GetRadialEntryDispatch(UUserWidget& EntryWidget)
+{
+	return FindOrAddMaterialCache(EntryWidget).Dispatch;
 }
 
 void URadialStrategyWidget::SyncMaterialData(const int32 InGlobalIndex)
@@ -563,19 +1076,54 @@ void URadialStrategyWidget::SyncMaterialData(const int32 InGlobalIndex)
 	UUserWidget* Widget = AcquireEntryWidget(InGlobalIndex);
 	const FStrategyEntrySlotData& SlotData = GlobalIndexToSlotData.FindChecked(InGlobalIndex);
 
-	const FGameplayTagContainer& ItemState = SlotData.TagState;
-
-	if (Widget && Widget->Implements<URadialItemEntry>())
+	if (Widget && EnumHasAnyFlags(SlotData.EntryState, EStrategyEntryState::Active))
 	{
-		const FGameplayTag& ActiveState = StrategyUIGameplayTags::StrategyUI::EntryLifecycle::Active;
-		if (ItemState.HasTag(ActiveState))
+		// Only update material data for active entries 
+		FRadialEntryMaterialCache& Cache = FindOrAddMaterialCache(*Widget);
+		if (Cache.Dispatch != EStrategyEntryDispatch::None)
 		{
-			// Only update material data for active entries 
 			FRadialItemMaterialData MaterialData;
-			ConstructMaterialData(Widget, InGlobalIndex, MaterialData);
+			if (!GetPrecomputedMaterialData(InGlobalIndex, *Widget, MaterialData))
+			{
+				ConstructMaterialData(Widget, InGlobalIndex, MaterialData);
+			}
+
+			if (Cache.bHasPushed && Cache.LastPushedData.Equals(MaterialData, MaterialDataPushTolerance))
+			{
+				return; // Nothing visibly changed since the last push
+			}
+			Cache.LastPushedData = MaterialData;
+			Cache.bHasPushed = true;
+
+			// Re-query if the entry recreated its material
+			if (!Cache.bHasQueriedDynamicMaterial || Cache.DynamicMaterial.IsStale())
+			{
+				Cache.DynamicMaterial = Cache.Dispatch == EStrategyEntryDispatch::Native
+					? static_cast<URadialEntryWidgetBase*>(Widget)->NativeGetRadialItemDynamicMaterial()
+					: IRadialItemEntry::Execute_BP_GetRadialItemDynamicMaterial(Widget);
+				Cache.bHasQueriedDynamicMaterial = true;
+			}
+
 			UE_LOG(LogStrategyUI, VeryVerbose, TEXT("Syncing material data %s for widget %s"), *MaterialData.ToString(), *Widget->GetName());
-			IRadialItemEntry::Execute_BP_SetRadialItemMaterialData(Widget, MaterialData);
-			Widget->InvalidateLayoutAndVolatility();
+			if (UMaterialInstanceDynamic* DynamicMaterial = Cache.DynamicMaterial.Get())
+			{
+				// Native path, no Blueprint round trip
+				MaterialData.ApplyToMaterial(*DynamicMaterial);
+			}
+			else if (Cache.Dispatch == EStrategyEntryDispatch::Native)
+			{
+				static_cast<URadialEntryWidgetBase*>(Widget)->NativeSetRadialItemMaterialData(MaterialData);
+			}
+			else
+			{
+				IRadialItemEntry::Execute_BP_SetRadialItemMaterialData(Widget, MaterialData);
+			}
+
+			// Material parameters only affect how the entry draws, a repaint is enough (and keeps invalidation caching intact)
+			if (SlotData.CachedSlateWidget.IsValid())
+			{
+				SlotData.CachedSlateWidget->Invalidate(EInvalidateWidgetReason::Paint);
+			}
 		}
 	}
 }
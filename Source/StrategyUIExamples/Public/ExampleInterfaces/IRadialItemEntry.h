@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <CoreMinimal.h>
 #include <UObject/Interface.h>
 
 #include <Interfaces/IStrategyEntryBase.h>
@@ -9,6 +10,7 @@
 #include "IRadialItemEntry.generated.h"
 
 enum class EStrategyEntryState : uint8;
+class UMaterialInstanceDynamic;
 
 /**
  * All floats are in [0..1] ready for use in a dynamic material.
@@ -46,6 +48,24 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere)
 	float DistanceFactor = 0.f;
 
+	/** Whether every value is within Tolerance of Other's. */
+	bool Equals(const FRadialItemMaterialData& Other, const float Tolerance = KINDA_SMALL_NUMBER) const
+	{
+		return FMath::IsNearlyEqual(UVCenterX, Other.UVCenterX, Tolerance)
+			&& FMath::IsNearlyEqual(UVCenterY, Other.UVCenterY, Tolerance)
+			&& FMath::IsNearlyEqual(WedgeWidth, Other.WedgeWidth, Tolerance)
+			&& FMath::IsNearlyEqual(AngleOffset, Other.AngleOffset, Tolerance)
+			&& FMath::IsNearlyEqual(SpiralMinRadius, Other.SpiralMinRadius, Tolerance)
+			&& FMath::IsNearlyEqual(SpiralMaxRadius, Other.SpiralMaxRadius, Tolerance)
+			&& FMath::IsNearlyEqual(DistanceFactor, Other.DistanceFactor, Tolerance);
+	}
+
+	/**
+	 * Writes every value as a scalar parameter of the same name (UVCenterX, UVCenterY, WedgeWidth, ...).
+	 * Defined in RadialStrategyWidget.cpp.
+	 */
+	void ApplyToMaterial(UMaterialInstanceDynamic& Material) const;
+
 	FString ToString() const
 	{
 		return FString::Printf(
@@ -64,7 +84,15 @@ class IRadialItemEntry : public IStrategyEntryBase
 {
 	GENERATED_IINTERFACE_BODY()
 public:
-	/** Called when the widget is assigned new material data */
+	/** Called when the widget is assigned new material data (unless it provides BP_GetRadialItemDynamicMaterial) */
 	UFUNCTION(BlueprintImplementableEvent, Category="IRadialItemEntry")
 	void BP_SetRadialItemMaterialData(const FRadialItemMaterialData& InMaterialData);
+
+	/**
+	 * Optionally return the dynamic material instance the entry draws its wedge with.
+	 * If one is returned, material data is written straight to its scalar parameters (see FRadialItemMaterialData::ApplyToMaterial)
+	 * instead of calling BP_SetRadialItemMaterialData. Queried once per entry widget.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category="IRadialItemEntry")
+	UMaterialInstanceDynamic* BP_GetRadialItemDynamicMaterial() const;
 };
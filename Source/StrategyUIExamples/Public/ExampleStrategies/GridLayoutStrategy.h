@@ -0,0 +1,170 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <Strategies/BaseLayoutStrategy.h>
+
+#include "GridLayoutStrategy.generated.h"
+
+// Which way a grid/list layout scrolls.
+UENUM(BlueprintType)
+enum class EGridLayoutOrientation : uint8
+{
+	Vertical,   // Rows stack top to bottom, columns run left to right
+	Horizontal, // Columns stack left to right, rows run top to bottom
+};
+
+/**
+ * Virtualized grid/list layout: uniform cells in rows of NumColumns (1 = list), scrolled along one axis.
+ *
+ * Every cell has the same size, so the visible window is computed straight from the scroll offset and the cell pitch
+ * and positions are a multiply-add per entry; neither depends on the number of items. Only the entries in view (plus
+ * NumDeactivatedEntries worth of overscan rows) get a slot, which lets the owning widget's pooled acquire/release keep
+ * a handful of widgets alive for inventories of tens of thousands of items.
+ *
+ * MaxVisibleEntries is kept at what fits the viewport (see SetViewportSize), so it doesn't need to be authored.
+ */
+UCLASS(ClassGroup="StrategyUI|GridLayout")
+class STRATEGYUIEXAMPLES_API UGridLayoutStrategy : public UBaseLayoutStrategy
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	//----------------------------------------------------------------------------------------------
+	// Editable Properties
+	//----------------------------------------------------------------------------------------------
+	/** Which axis the layout scrolls along. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategy|Layout")
+	EGridLayoutOrientation Orientation = EGridLayoutOrientation::Vertical;
+
+	/**
+	 * Number of cells across the scroll axis (1 for a list).
+	 * 0 fits as many as the viewport allows.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategy|Layout", meta=(ClampMin="0"))
+	int32 NumColumns = 0;
+
+	/** Size of every cell, in slate units. Entries are centered on their cell. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategy|Layout")
+	FVector2D CellSize = FVector2D(128.f, 128.f);
+
+	/** Gap between neighbouring cells, in slate units. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategy|Layout")
+	FVector2D CellSpacing = FVector2D(8.f, 8.f);
+
+	/** Padding between the viewport edges and the first/last row along the scroll axis, in slate units. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategy|Layout", meta=(ClampMin="0.0"))
+	float ContentPadding = 0.f;
+
+	//--------------------------------------------------------------------------
+	// BaseLayoutStrategy overrides
+	//--------------------------------------------------------------------------
+	virtual void InitializeStrategy(TScriptInterface<ILayoutStrategyHost> Host) override;
+	virtual void ValidateStrategy(TArray<FText>& OutErrors) const override;
+	virtual FVector2D GetItemPosition(const int32 GlobalIndex) const override;
+	virtual void ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const override;
+	virtual int32 FindFocusedGlobalIndex() const override;
+	virtual int32 GetGlobalIndexDistance(const int32 GlobalIndexA, const int32 GlobalIndexB) const override;
+	virtual FInt32Range ComputeDesiredGlobalIndexRange() override;
+	virtual int32 GlobalIndexToDataIndex(const int32 GlobalIndex) const override;
+	virtual bool ShouldBeVisible(const int32 GlobalIndex) const override;
+	virtual void DrawDebugVisuals(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, const int32 LayerId, const FVector2D& Center) const override;
+
+	//----------------------------------------------------------------------------------------------
+	// Grid Layout Strategy API
+	//----------------------------------------------------------------------------------------------
+	/** Sets the size of the area the grid is shown in, which decides how many rows (and auto columns) fit. */
+	void SetViewportSize(const FVector2D& InViewportSize);
+
+	/** Size of the area the grid is shown in. */
+	const FVector2D& GetViewportSize() const { return ViewportSize; }
+
+	/**
+	 * Sets how far the content is scrolled along the scroll axis, clamped to [0, GetMaxScrollOffset()].
+	 * @return The offset actually applied.
+	 */
+	float SetScrollOffset(const float InScrollOffset);
+
+	/** How far the content is scrolled along the scroll axis, in slate units. */
+	float GetScrollOffset() const { return ScrollOffset; }
+
+	/** The furthest the content can be scrolled; 0 when everything fits. */
+	float GetMaxScrollOffset() const;
+
+	/** The scroll offset that brings GlobalIndex fully into view while moving as little as possible. */
+	float GetScrollOffsetToBringIntoView(const int32 GlobalIndex) const;
+
+	/** Sets the focused entry (e.g. from gamepad navigation), clamped to the items. INDEX_NONE falls back to the first visible entry. */
+	void SetFocusedGlobalIndex(const int32 InGlobalIndex);
+
+	/**
+	 * The global index DeltaColumns/DeltaRows cells away from GlobalIndex, clamped to the grid.
+	 * Moving sideways past the end of a row continues on the next/previous one.
+	 */
+	int32 GetNeighbourGlobalIndex(const int32 GlobalIndex, const int32 DeltaColumns, const int32 DeltaRows) const;
+
+	/** Number of cells per row across the scroll axis, after resolving NumColumns = 0. */
+	int32 GetResolvedNumColumns() const { return ResolvedNumColumns; }
+
+	/** Number of rows needed for every item. */
+	int32 GetNumRows() const { return FMath::DivideAndRoundUp(NumItems, ResolvedNumColumns); }
+
+	/** Distance between the starts of two consecutive rows, along the scroll axis. */
+	float GetRowPitch() const;
+
+	/** The first/last global index at least partly inside the viewport (INDEX_NONE when empty). */
+	int32 GetVisibleStartIndex() const { return VisibleStartIndex; }
+	int32 GetVisibleEndIndex() const { return VisibleEndIndex; }
+
+protected:
+	/** Resolves ResolvedNumColumns and MaxVisibleEntries for the current viewport and cell size. */
+	void UpdateGridMetrics();
+
+	/** Distance between the starts of two consecutive cells in a row, across the scroll axis. */
+	float GetColumnPitch() const;
+
+	/** Maps a position along the scroll axis (MainAxis) and across it (CrossAxis) to X/Y for the current Orientation. */
+	FVector2D MakeCellPosition(const float MainAxis, const float CrossAxis) const;
+
+	/** Position along the scroll axis of the center of Row, relative to the viewport center. */
+	float GetRowCenter(const int32 Row) const;
+
+	/** Position across the scroll axis of the center of Column, relative to the viewport center. */
+	float GetColumnCenter(const int32 Column) const;
+
+	//----------------------------------------------------------------------------------------------
+	// Runtime Properties
+	//----------------------------------------------------------------------------------------------
+	/** Number of data item objects provided to the layout */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Data")
+	int32 NumItems = 0;
+
+	/** Size of the area the grid is shown in */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Layout")
+	FVector2D ViewportSize = FVector2D::ZeroVector;
+
+	/** How far the content is scrolled along the scroll axis */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Layout")
+	float ScrollOffset = 0.f;
+
+	/** Cells per row, NumColumns with 0 resolved against the viewport */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Layout")
+	int32 ResolvedNumColumns = 1;
+
+	/** The first global index at least partly inside the viewport */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Layout")
+	int32 VisibleStartIndex = INDEX_NONE;
+
+	/** The last global index at least partly inside the viewport */
+	UPROPERTY(BlueprintReadOnly, Category="StrategyUI|GridStrategy|Layout")
+	int32 VisibleEndIndex = INDEX_NONE;
+
+	/** The entry navigation last moved focus to, or INDEX_NONE */
+	int32 FocusedGlobalIndex = INDEX_NONE;
+};
@@ -42,12 +42,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|Layout")
 	float DistanceFactorTurnThreshold = 2.f;
 
+	/**
+	 * If true, the deactivated margin follows the pointer's angular velocity instead of a fixed NumDeactivatedEntries:
+	 * it grows ahead of the motion (so entries have time to load before they scroll in), drops to
+	 * TrailingDeactivatedEntries behind it, and settles back to IdleDeactivatedEntries at rest.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin")
+	bool bUseAdaptiveDeactivatedMargin = false;
+
+	/** Deactivated entries on each side of the window while the pointer is at rest. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin", meta=(ClampMin="0", EditCondition="bUseAdaptiveDeactivatedMargin"))
+	int32 IdleDeactivatedEntries = 1;
+
+	/** Deactivated entries behind the motion while the pointer is turning. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin", meta=(ClampMin="0", EditCondition="bUseAdaptiveDeactivatedMargin"))
+	int32 TrailingDeactivatedEntries = 0;
+
+	/** Upper bound for the deactivated entries ahead of the motion. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin", meta=(ClampMin="0", ClampMax="64", EditCondition="bUseAdaptiveDeactivatedMargin"))
+	int32 MaxLeadingDeactivatedEntries = 16;
+
+	/** How far ahead (in seconds at the current velocity) the leading margin reaches. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin", meta=(ClampMin="0.0", Units="s", EditCondition="bUseAdaptiveDeactivatedMargin"))
+	float DeactivatedMarginLookAheadTime = 0.5f;
+
+	/** Below this pointer speed (degrees per second), the pointer counts as at rest. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpiralStrategy|DeactivatedMargin", meta=(ClampMin="0.0", EditCondition="bUseAdaptiveDeactivatedMargin"))
+	float IdleAngularVelocityThreshold = 5.f;
+
 	//--------------------------------------------------------------------------
 	// BaseLayoutStrategy overrides
 	//--------------------------------------------------------------------------
 	virtual FVector2D GetItemPosition(const int32 GlobalIndex) const override;
+	virtual void ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const override;
 	virtual int32 FindFocusedGlobalIndex() const override;
-	virtual TSet<int32> ComputeDesiredGlobalIndices() override;
+	virtual FInt32Range ComputeDesiredGlobalIndexRange() override;
 	virtual int32 GlobalIndexToDataIndex(const int32 GlobalIndex) const override;
 
 	/**
@@ -65,6 +94,9 @@ public:
 	// RadialLayoutStrategy overrides
 	//--------------------------------------------------------------------------
 	virtual int32 UpdateGapSegments(const int32 TotalItems) override;
+	virtual int32 FindGlobalIndexForAngle(const float InAngle) const override;
+	virtual FInt32Range ComputeDesiredGlobalIndexRangeForAngle(const float InAngle) const override;
+	virtual void GetDeactivatedMargins(int32& OutLowerMargin, int32& OutUpperMargin) const override;
 	virtual float ComputeShortestUnboundAngleForDataIndex(const int32 DataIndex) const override;
 	
 	virtual float CalculateItemAngleDegreesForGlobalIndex(int32 GlobalIndex) const override;
@@ -73,4 +105,46 @@ public:
 	
 	virtual float GetMinRadius() const override { return BaseRadius + SpiralInwardOffset; }
 	virtual float GetMaxRadius() const override { return BaseRadius + SpiralOutwardOffset; }
+
+	virtual void ComputeItemAnglesDegrees(const FInt32Range& GlobalIndexRange, TArrayView<float> OutAnglesDegrees) const override;
+	virtual void ComputeDistanceFactors(const FInt32Range& GlobalIndexRange, TArrayView<float> OutDistanceFactors) const override;
+	virtual TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> MakeLayoutSnapshot(const float InPointerAngle) const override;
+
+protected:
+	/** Distance factor of an item at ItemAngleDeg, shared by the per-index and batched paths. */
+	float CalculateDistanceFactorForAngle(const float ItemAngleDeg) const;
+
+	/**
+	 * Slides WindowCache onto GlobalIndexRange: entries still inside it are kept, so a one-wedge step only evaluates
+	 * the direction of the single entry entering the window. Anything else (a jump, a new segment count) rebuilds it.
+	 */
+	void UpdateWindowCache(const FInt32Range& GlobalIndexRange) const;
+
+	/** Re-evaluates the distance factors of the cached window in one pass, if the pointer moved since they were. */
+	void UpdateWindowDistanceFactors() const;
+
+	/** Whether GlobalIndexRange lies inside the cached window. */
+	bool IsInWindowCache(const FInt32Range& GlobalIndexRange) const;
+
+	/** State of the desired window, reused while it slides with the pointer. Indexed by (global index - FirstGlobalIndex). */
+	struct FSpiralWindowCache
+	{
+		int32 FirstGlobalIndex = 0;
+
+		/** Unit direction (cos, sin) of each entry's fixed angle; only depends on the global index and angular spacing. */
+		TArray<FVector2D, TInlineAllocator<MAX_ENTRY_COUNT>> Directions;
+
+		/** Distance factor of each entry, which follows the pointer. */
+		TArray<float, TInlineAllocator<MAX_ENTRY_COUNT>> DistanceFactors;
+
+		/** The inputs Directions and DistanceFactors were evaluated for. */
+		float AngularSpacing = 0.f;
+		float DistanceFactorsPointerAngle = 0.f;
+		float DistanceFactorsTurnThreshold = 0.f;
+		bool bDistanceFactorsValid = false;
+
+		int32 Num() const { return Directions.Num(); }
+		bool Contains(const int32 GlobalIndex) const { return GlobalIndex >= FirstGlobalIndex && GlobalIndex < FirstGlobalIndex + Num(); }
+	};
+	mutable FSpiralWindowCache WindowCache;
 };
@@ -17,19 +17,42 @@ class STRATEGYUIEXAMPLES_API UWheelLayoutStrategy : public URadialLayoutStrategy
 	GENERATED_BODY()
 
 public:
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	//--------------------------------------------------------------------------
 	// BaseLayoutStrategy overrides
 	//--------------------------------------------------------------------------
 	virtual void InitializeStrategy(TScriptInterface<ILayoutStrategyHost> Host) override;
 	virtual FVector2D GetItemPosition(const int32 GlobalIndex) const override;
+	virtual void ComputeItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const override;
 	virtual int32 FindFocusedGlobalIndex() const override;
-	virtual TSet<int32> ComputeDesiredGlobalIndices() override;
+	virtual int32 GetGlobalIndexDistance(const int32 GlobalIndexA, const int32 GlobalIndexB) const override;
+	virtual FInt32Range ComputeDesiredGlobalIndexRange() override;
 
 	//--------------------------------------------------------------------------
 	// RadialLayoutStrategy overrides
 	//--------------------------------------------------------------------------	
 	virtual float SanitizeAngle(const float InAngle) const override;
+	virtual int32 FindGlobalIndexForAngle(const float InAngle) const override;
 	virtual int32 UpdateGapSegments(const int32 TotalItems) override;
 	virtual float ComputeShortestUnboundAngleForDataIndex(const int32 DataIndex) const override;
 	virtual float CalculateDistanceFactorForGlobalIndex(const int32 GlobalIndex) const override;
+	virtual TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> MakeLayoutSnapshot(const float InPointerAngle) const override;
+
+protected:
+	/**
+	 * Rebuilds CachedSegmentPositions if BaseRadius, RadialSegmentCount or AngularSpacing changed since it was built.
+	 * Wheel positions depend on nothing else, so this is a few compares once the table exists.
+	 */
+	void UpdatePositionTable() const;
+
+	/** Position of every segment, indexed by (clamped) global index */
+	mutable TArray<FVector2D> CachedSegmentPositions;
+
+	/** The inputs CachedSegmentPositions was built from */
+	mutable float CachedBaseRadius = 0.f;
+	mutable int32 CachedSegmentCount = INDEX_NONE;
+	mutable float CachedAngularSpacing = 0.f;
 };
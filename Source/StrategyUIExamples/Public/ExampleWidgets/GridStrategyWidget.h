@@ -0,0 +1,184 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <Widgets/BaseStrategyWidget.h>
+
+#include "GridStrategyWidget.generated.h"
+
+class UGridLayoutStrategy;
+
+// Delegate for when the grid's scroll offset changes. Offset is in slate units along the scroll axis.
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGridScrollOffsetUpdatedDelegate, float, ScrollOffset, float, MaxScrollOffset);
+
+/**
+ * A container widget that shows items in a virtualized grid or list (see UGridLayoutStrategy).
+ * Scrolls from the mouse wheel, drags, sticks or focus navigation, with inertia after wheel flicks and drag releases.
+ *
+ * Only the entries in view (plus the strategy's overscan rows) are backed by pooled entry widgets, so it can stand in
+ * for a UTileView/UListView over very large inventories.
+ */
+UCLASS(Abstract, ClassGroup="StrategyUI")
+class STRATEGYUIEXAMPLES_API UGridStrategyWidget : public UBaseStrategyWidget
+{
+	GENERATED_BODY()
+
+public:
+
+#if WITH_EDITOR
+	virtual void ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const override;
+#endif
+
+	// ---------------------------------------------------------------------------------------------
+	// UBaseStrategyWidget API Overrides
+	// ---------------------------------------------------------------------------------------------
+#pragma region UBaseStrategyWidget API Overrides
+	virtual void Reset() override;
+	virtual void UpdateWidgets() override;
+
+	virtual void SetItems_Internal_Implementation(const TArray<UObject*>& InItems) override;
+	virtual void OnDataProviderDelta(const FStrategyDataProviderDelta& Delta) override;
+#pragma endregion
+
+	// ---------------------------------------------------------------------------------------------
+	// UGridStrategyWidget API
+	// ---------------------------------------------------------------------------------------------
+#pragma region UGridStrategyWidget API
+	/**
+	 * Scrolls by an amount, e.g. from a mouse wheel notch. With inertia the scroll eases out over a few frames
+	 * (the added velocity coasts exactly Delta), otherwise it's applied right away.
+	 * @param Delta     Slate units along the scroll axis (positive scrolls toward the end).
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	virtual void HandleScrollInput(float Delta);
+
+	/**
+	 * Scrolls continuously from an analog stick, at up to StickScrollSpeed.
+	 * @param Delta     2D directional input in screen orientation (+Y scrolls down); only the scroll axis component is used.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	virtual void HandleStickInput(const FVector2D& Delta);
+
+	/**
+	 * Moves focus by a number of cells (e.g. from d-pad navigation), scrolling the new focus into view.
+	 * @param DeltaColumns  Cells to move within a row (wraps onto neighbouring rows).
+	 * @param DeltaRows     Rows to move along the scroll axis.
+	 */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	virtual void StepFocus(int32 DeltaColumns, int32 DeltaRows);
+
+	/** Scrolls (instantly) so the given data index is in view, and focuses it. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	virtual void ScrollToItem(int32 DataIndex);
+
+	/** Sets the scroll offset directly, stopping any inertia. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	virtual void SetScrollOffset(float InScrollOffset);
+
+	/** Stops scrolling inertia in place. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|GridStrategyWidget")
+	void StopInertialScrolling();
+
+	/** Current scroll offset along the scroll axis, in slate units. */
+	UFUNCTION(BlueprintPure, Category="StrategyUI|GridStrategyWidget")
+	float GetScrollOffset() const;
+#pragma endregion
+
+protected:
+	//----------------------------------------------------------------------------------------------
+	// UWidget Overrides
+	//----------------------------------------------------------------------------------------------
+#pragma region UUserWidget & UWidget Overrides
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnMouseMove(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnMouseButtonUp(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual void NativeOnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent) override;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// UGridStrategyWidget - Events
+	//----------------------------------------------------------------------------------------------
+#pragma region UGridStrategyWidget - Events
+	/** Broadcasts the scroll offset when it changes, e.g. to drive a scroll bar. */
+	UPROPERTY(BlueprintAssignable, Category="StrategyUI|GridStrategyWidget|Event")
+	FGridScrollOffsetUpdatedDelegate OnScrollOffsetUpdated;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// UGridStrategyWidget Properties - Editable
+	//----------------------------------------------------------------------------------------------
+#pragma region UGridStrategyWidget Properties - Editable
+	/** How far one mouse wheel notch scrolls, in slate units. 0 scrolls one row. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(ClampMin="0.0"))
+	float WheelScrollAmount = 0.f;
+
+	/** Scroll speed at full stick deflection, in slate units per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(ClampMin="0.0"))
+	float StickScrollSpeed = 1500.f;
+
+	/** Whether wheel flicks and drag releases keep scrolling and slow down over time, instead of stopping dead. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling")
+	bool bUseInertialScrolling = true;
+
+	/**
+	 * How quickly inertia dies down (per second). Higher stops sooner.
+	 * Velocity decays by exp(-InertialScrollFriction * DeltaTime) every tick.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(ClampMin="0.1", EditCondition="bUseInertialScrolling"))
+	float InertialScrollFriction = 5.f;
+
+	/** Fastest inertia can scroll, in slate units per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(ClampMin="0.0", EditCondition="bUseInertialScrolling"))
+	float MaxInertialScrollSpeed = 8000.f;
+
+	/** Whether dragging with the left mouse button (or a touch) scrolls the content. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|GridStrategyWidget|Scrolling")
+	bool bAllowDragScrolling = true;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// UGridStrategyWidget Properties - Runtime
+	//----------------------------------------------------------------------------------------------
+#pragma region UGridStrategyWidget Properties - Runtime
+	/** Inertial scroll velocity along the scroll axis, in slate units per second. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(AllowPrivateAccess="true"))
+	float ScrollVelocity = 0.f;
+
+	/** True while a drag is scrolling the content. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|GridStrategyWidget|Scrolling", meta=(AllowPrivateAccess="true"))
+	bool bIsDragScrolling = false;
+
+	/** Scroll applied by drags since the last tick, tracked into ScrollVelocity so releasing a drag coasts. */
+	float PendingDragScroll = 0.f;
+
+	/** Local position of the pointer when the drag last moved. */
+	FVector2D LastDragPosition = FVector2D::ZeroVector;
+
+	/** Whether the layout needs refreshing on the next tick. */
+	bool bLayoutDirty = true;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// UGridStrategyWidget Functions - Scrolling
+	//----------------------------------------------------------------------------------------------
+#pragma region UGridStrategyWidget Functions - Scrolling
+	/** Applies a scroll delta through the strategy, stopping inertia at either end. */
+	virtual void AddScrollOffset_Internal(float Delta);
+
+	/** Pushes the scroll offset to the strategy and broadcasts OnScrollOffsetUpdated if it moved. */
+	virtual void SetScrollOffset_Internal(float InScrollOffset);
+
+	/** Advances inertia by InDeltaTime. */
+	virtual void UpdateInertialScrolling(float InDeltaTime);
+
+	/** The scroll axis component of a screen-space vector, for the strategy's orientation. */
+	float GetScrollAxisComponent(const FVector2D& InVector) const;
+
+	/** Updates the focused index from the layout strategy. */
+	void UpdateFocusIndex();
+#pragma endregion
+};
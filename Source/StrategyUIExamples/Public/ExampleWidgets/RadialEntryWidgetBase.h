@@ -0,0 +1,45 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <Widgets/StrategyEntryWidgetBase.h>
+
+#include "ExampleInterfaces/IRadialItemEntry.h"
+
+#include "RadialEntryWidgetBase.generated.h"
+
+class UMaterialInstanceDynamic;
+
+/**
+ * UStrategyEntryWidgetBase for URadialStrategyWidget entries, adding native hooks for the IRadialItemEntry events.
+ * URadialStrategyWidget treats every subclass as a radial entry. IRadialItemEntry isn't inherited in C++ (it would
+ * implement IStrategyEntryBase twice); to implement its events in Blueprint, add it under Class Settings > Interfaces.
+ * Like the base, each hook only goes through its BP_ event if a Blueprint subclass implements it.
+ */
+UCLASS(Abstract)
+class STRATEGYUIEXAMPLES_API URadialEntryWidgetBase : public UStrategyEntryWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Called when the widget is assigned new material data. Forwards to BP_SetRadialItemMaterialData. */
+	virtual void NativeSetRadialItemMaterialData(const FRadialItemMaterialData& InMaterialData);
+
+	/**
+	 * The dynamic material the entry draws its wedge with, if material data should be written straight to it.
+	 * Forwards to BP_GetRadialItemDynamicMaterial.
+	 */
+	virtual UMaterialInstanceDynamic* NativeGetRadialItemDynamicMaterial() const;
+
+	/** Whether this widget's class implements BP_SetRadialItemMaterialData in Blueprint. */
+	bool ImplementsSetMaterialDataInBlueprint() const;
+
+private:
+	void ResolveBlueprintRadialEvents() const;
+
+	mutable bool bImplementsSetMaterialDataInBlueprint = false;
+	mutable bool bImplementsGetDynamicMaterialInBlueprint = false;
+	mutable bool bHasResolvedBlueprintRadialEvents = false;
+};
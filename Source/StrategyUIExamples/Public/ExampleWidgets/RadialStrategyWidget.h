@@ -2,17 +2,23 @@
 
 #include <CoreMinimal.h>
 #include <Blueprint/UserWidgetPool.h>
+#include <Tasks/Task.h>
 
 #include <Widgets/BaseStrategyWidget.h>
 
+#include "ExampleInterfaces/IRadialItemEntry.h"
+
 #include "RadialStrategyWidget.generated.h"
 
-struct FRadialItemMaterialData;
 class URadialLayoutStrategy;
+struct FRadialLayoutSnapshot;
+class UMaterialInstanceDynamic;
 class UBaseStrategyWidget;
 
 // Delegate for when the radial pointer's rotation angle updates. Angle is passed in degrees [-180, 180].
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRadialPointerRotationUpdatedDelegate, float, Angle);
+// Native counterpart of FRadialPointerRotationUpdatedDelegate, without the reflection overhead.
+DECLARE_MULTICAST_DELEGATE_OneParam(FRadialPointerRotationUpdatedNativeDelegate, float /*Angle*/);
 
 // Holds all data needed for animating a scroll from one angle to another.
 USTRUCT(BlueprintType)
@@ -46,6 +52,20 @@ public:
 	float DeltaAngle = 0.f;
 };
 
+// Reasons a URadialStrategyWidget needs to refresh its layout on the next tick.
+enum class ERadialWidgetDirtyFlags : uint8
+{
+	None            = 0,
+	PointerAngle    = 1 << 0, // The pointer angle changed (input, animation, reset)
+	Items           = 1 << 1, // New items were set
+	Geometry        = 1 << 2, // The widget's allotted size changed
+	EntryLoading    = 1 << 3, // Entries are still loading or haven't reported a size yet
+	PointerVelocity = 1 << 4, // The tracked pointer velocity changed (e.g. still settling after input stopped)
+	LayoutJob       = 1 << 5, // A layout pass computed off the game thread is waiting to be presented
+	All             = PointerAngle | Items | Geometry | EntryLoading | PointerVelocity | LayoutJob
+};
+ENUM_CLASS_FLAGS(ERadialWidgetDirtyFlags);
+
 
 /**
  * A container widget that arranges items in a radial layout.
@@ -72,6 +92,9 @@ public:
 	virtual void UpdateWidgets() override;
 
 	virtual void SetItems_Internal_Implementation(const TArray<UObject*>& InItems) override;
+	virtual void OnDataProviderDelta(const FStrategyDataProviderDelta& Delta) override;
+	virtual void OnAsyncWidgetLoadBatchCompleted_Implementation(const TArray<int32>& LoadedGlobalIndices) override;
+	virtual bool GetPrecomputedItemPositions(const FInt32Range& GlobalIndexRange, TArrayView<FVector2D> OutPositions) const override;
 #pragma endregion
 	
 	// ---------------------------------------------------------------------------------------------
@@ -134,6 +157,9 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="StrategyUI|RadialStrategyWidget|Animation")
 	virtual void ScrollToCenterOfFocusedWedgeAnimated(float Duration);
+
+	/** Same as OnPointerRotationUpdated (in degrees [-180..180]), for C++ listeners. */
+	FRadialPointerRotationUpdatedNativeDelegate& OnPointerRotationUpdatedNative() { return PointerRotationUpdatedNativeDelegate; }
 #pragma endregion
 
 protected:
@@ -153,6 +179,21 @@ protected:
 	) const override;
 #pragma endregion
 
+	//----------------------------------------------------------------------------------------------
+	// UBaseStrategyWidget Entry Widget Overrides
+	//----------------------------------------------------------------------------------------------
+#pragma region UBaseStrategyWidget Entry Widget Overrides
+	virtual void ReleaseEntryWidget(int32 GlobalIndex) override;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// UBaseStrategyWidget Hibernation Overrides
+	//----------------------------------------------------------------------------------------------
+#pragma region UBaseStrategyWidget Hibernation Overrides
+	virtual void Hibernate() override;
+	virtual void WakeFromHibernation() override;
+#pragma endregion
+
 	//----------------------------------------------------------------------------------------------
 	// URadialStrategyWidget - Debug Drawing
 	//----------------------------------------------------------------------------------------------
@@ -170,6 +211,9 @@ protected:
 	/** Broadcasts the current pointer angle when it changes (in degrees [-180..180]). */
 	UPROPERTY(BlueprintAssignable, Category="StrategyUI|RadialStrategyWidget|Event")
 	FRadialPointerRotationUpdatedDelegate OnPointerRotationUpdated;
+
+	/** See OnPointerRotationUpdatedNative(). */
+	FRadialPointerRotationUpdatedNativeDelegate PointerRotationUpdatedNativeDelegate;
 #pragma endregion
 
 	//----------------------------------------------------------------------------------------------
@@ -183,6 +227,37 @@ protected:
 	/** Gap (in degrees) between wedge slices used in the calculation of the radial wedge material. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget")
 	float DynamicWedgeGapSize = 1.f;
+
+	/** Material data within this tolerance of what was last pushed to an entry is not pushed again. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget", meta=(ClampMin="0.0"))
+	float MaterialDataPushTolerance = 1.e-4f;
+
+	/**
+	 * When nothing is dirty (no pointer movement, animation, new items, resize or pending loads), stop ticking entirely
+	 * until something wakes the widget back up. Disable if a subclass relies on NativeTick running every frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget")
+	bool bSleepWhenIdle = true;
+
+	/**
+	 * How quickly the tracked pointer velocity follows input (per second). Higher reacts faster, lower is steadier.
+	 * The velocity is handed to the layout strategy, e.g. for USpiralLayoutStrategy's adaptive deactivated margin.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget", meta=(ClampMin="0.1"))
+	float PointerVelocitySmoothingRate = 8.f;
+
+	/**
+	 * Compute entry positions and material data on a worker thread instead of the game thread.
+	 * Each refresh presents the pass computed from the previous refresh's pointer angle and hands the current one to the
+	 * worker, so what's shown trails input by a tick. Needs a layout strategy that supports
+	 * URadialLayoutStrategy::MakeLayoutSnapshot (wheel and spiral do); others stay on the game thread.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget|Threading")
+	bool bComputeLayoutOffGameThread = false;
+
+	/** Entries per ParallelFor batch on the worker. Windows no larger than this are computed by one worker alone. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="StrategyUI|RadialStrategyWidget|Threading", meta=(ClampMin="1", EditCondition="bComputeLayoutOffGameThread"))
+	int32 LayoutBatchSize = 32;
 #pragma endregion
 
 	//----------------------------------------------------------------------------------------------
@@ -200,18 +275,116 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|RadialStrategyWidget|Animation", meta=(AllowPrivateAccess="true"))
 	FRadialScrollAnimationData RuntimeScrollingAnimState;
 
+	/** Smoothed angular velocity of the pointer from user input, in degrees per second. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category="StrategyUI|RadialStrategyWidget|Pointer", meta=(AllowPrivateAccess="true"))
+	float PointerAngularVelocity = 0.f;
+
+	/** Rotation applied by HandleStickInput/HandleMouseInput since the last tick. */
+	float PendingInputRotationDegrees = 0.f;
+
+	/** Angle from input since the last tick, waiting for FlushQueuedInputAngle. Only meaningful if bHasQueuedInputAngle. */
+	float QueuedInputAngle = 0.f;
+
+	/** True while QueuedInputAngle holds input that SetCurrentAngle hasn't been given yet. */
+	bool bHasQueuedInputAngle = false;
+
 	/** Flag set when at least one entry widget has valid geometry. */
 	mutable bool bAreChildrenReady = false;
+
+	/** What was last pushed to an entry widget's material, where it goes, and how the entry takes it. */
+	struct FRadialEntryMaterialCache
+	{
+		FRadialItemMaterialData LastPushedData;
+		TWeakObjectPtr<UMaterialInstanceDynamic> DynamicMaterial;
+
+		/** Native for URadialEntryWidgetBase, Interface for other IRadialItemEntry widgets, None for anything else */
+		EStrategyEntryDispatch Dispatch = EStrategyEntryDispatch::Unresolved;
+
+		bool bHasPushed = false;
+		bool bHasQueriedDynamicMaterial = false;
+	};
+
+	/**
+	 * Material push cache, keyed by entry widget rather than global index: a widget keeps its material state when it
+	 * moves to another index. Entries are forgotten once their widget goes back to the shared pool, where another
+	 * strategy widget may take it.
+	 */
+	TMap<TObjectKey<UUserWidget>, FRadialEntryMaterialCache> EntryMaterialCache;
+
+	/** What needs refreshing on the next tick. Per instance, so one idle menu never suppresses another's updates. */
+	mutable ERadialWidgetDirtyFlags DirtyFlags = ERadialWidgetDirtyFlags::All;
+
+	/** Ticks left to keep refreshing after entries finished loading, so they get a chance to report their size. */
+	int32 EntrySettleTicksRemaining = 0;
+
+	/** Allotted size seen on the last paint, used to detect resizes while the widget is asleep. */
+	mutable FVector2D LastPaintedGeometrySize = FVector2D::ZeroVector;
+
+	/** True while Slate ticking is switched off for this widget. */
+	mutable bool bIsSleeping = false;
+
+	/** Inputs and results of one layout pass over a window, computed off the game thread (see bComputeLayoutOffGameThread). */
+	struct FRadialLayoutJob
+	{
+		/** The strategy's inputs, copied on the game thread */
+		TSharedPtr<FRadialLayoutSnapshot, ESPMode::ThreadSafe> Snapshot;
+
+		/** Pointer angle as the widget had it, before the strategy sanitized it into Snapshot */
+		float PointerAngle = 0.f;
+
+		FInt32Range WindowRange = FInt32Range::Empty();
+		float WedgeGapSize = 0.f;
+		int32 BatchSize = 1;
+
+		/** Desired size of each window entry; zero where there's no sized radial entry to make material data for */
+		TArray<FVector2D> EntrySizes;
+
+		/** Results, indexed like EntrySizes */
+		TArray<FVector2D> Positions;
+		TArray<FRadialItemMaterialData> MaterialData;
+
+		/** Computes the results from the inputs alone; runs on a worker. */
+		void Execute();
+	};
+
+	/**
+	 * The pass being computed (back buffer) and the one being presented (front buffer); they swap once the former is done.
+	 * Swapping keeps both allocations around, so steady-state passes don't allocate their arrays.
+	 */
+	TSharedPtr<FRadialLayoutJob, ESPMode::ThreadSafe> PendingLayoutJob;
+	TSharedPtr<FRadialLayoutJob, ESPMode::ThreadSafe> PresentedLayoutJob;
+
+	/** The worker task computing PendingLayoutJob, if one is in flight. */
+	UE::Tasks::FTask PendingLayoutTask;
 #pragma endregion
 
 	//----------------------------------------------------------------------------------------------
 	// URadialStrategyWidget Functions - Rotation Handling
 	//----------------------------------------------------------------------------------------------
 #pragma region URadialStrategyWidget Functions - Rotation Handling
-	/** Updates the current pointer angle, triggers OnPointerRotationUpdated event delegate. */
+	/**
+	 * Updates the current pointer angle, triggers OnPointerRotationUpdated event delegate.
+	 * Every angle change ends up here. Stick and mouse input doesn't call it right away: it's queued (QueueInputAngle)
+	 * and arrives once per tick, from FlushQueuedInputAngle at the start of NativeTick.
+	 */
 	virtual void SetCurrentAngle(const float InNewAngle);
 
-	/** Called by HandleInput to apply a direct rotation to CurrentAngle. */
+	/**
+	 * Like SetCurrentAngle, but the layout strategy and OnPointerRotationUpdated only hear about it once per tick (see
+	 * FlushQueuedInputAngle), however many input events arrive in between.
+	 */
+	void QueueInputAngle(float InNewAngle);
+
+	/** Passes the angle from QueueInputAngle, if any, to SetCurrentAngle. */
+	void FlushQueuedInputAngle();
+
+	/** The angle input builds on: the queued one if input arrived since the last tick, CurrentPointerAngle otherwise. */
+	float GetInputPointerAngle() const { return bHasQueuedInputAngle ? QueuedInputAngle : CurrentPointerAngle; }
+
+	/** Broadcasts CurrentPointerAngle to OnPointerRotationUpdated and OnPointerRotationUpdatedNative. */
+	void BroadcastPointerRotationUpdated() const;
+
+	/** Called by HandleStickInput to apply a direct rotation to CurrentAngle, queued like QueueInputAngle. */
 	virtual void ApplyManualRotation(float DeltaDegrees);
 	
 	/** Adds degrees to CurrentAngle, triggers layout update. */
@@ -220,10 +393,56 @@ protected:
 	/** Begin an animation from CurrentAngle to InTargetAngle over Duration. */
 	virtual void BeginAngleAnimation(float InTargetAngle, float Duration);
 
+	/**
+	 * Prefetches (see PrefetchEntryWidgets) the entries a scroll from InStartAngle to InEndAngle brings into view,
+	 * in the order the scroll reaches them.
+	 */
+	virtual void PrefetchAngleAnimationPath(float InStartAngle, float InEndAngle);
+
+	/** Folds the input rotation since the last tick into PointerAngularVelocity and hands it to the layout strategy. */
+	virtual void UpdatePointerAngularVelocity(float InDeltaTime);
+
 	/** Called by StepIndexAnimated to determine the final duration based on the number of gap items crossed. */
 	virtual float ScaleDurationByGapItems(const float FinalDuration) const;
 #pragma endregion
 
+	//----------------------------------------------------------------------------------------------
+	// URadialStrategyWidget Functions - Idle Sleep
+	//----------------------------------------------------------------------------------------------
+#pragma region URadialStrategyWidget Functions - Idle Sleep
+	/** Flags the layout for a refresh and wakes the widget if it was asleep. */
+	void MarkDirty(ERadialWidgetDirtyFlags InFlags) const;
+
+	/** Switches Slate ticking off (or back on) for this widget. */
+	void SetSleeping(bool bInSleeping) const;
+#pragma endregion
+
+	//----------------------------------------------------------------------------------------------
+	// URadialStrategyWidget Functions - Off Game Thread Layout
+	//----------------------------------------------------------------------------------------------
+#pragma region URadialStrategyWidget Functions - Off Game Thread Layout
+	/**
+	 * Refreshes the layout for InReasons. With bComputeLayoutOffGameThread, presents the pass in flight and, unless it
+	 * was the only reason to refresh, hands the current input to the worker.
+	 */
+	void RefreshLayout(ERadialWidgetDirtyFlags InReasons);
+
+	/** Waits for the pass in flight (normally long done by the next tick) and makes it the presented one. */
+	void CompleteLayoutJob();
+
+	/** Snapshots the current input and starts computing it on a worker. */
+	void LaunchLayoutJob();
+
+	/** Drops both passes, waiting for the one in flight, e.g. when the items change under them. */
+	void ResetLayoutJobs();
+
+	/** The presented pass, if it was computed for the pointer angle the layout strategy is at. */
+	const FRadialLayoutJob* GetPresentedLayoutJob() const;
+
+	/** Material data for InGlobalIndex from the presented pass, if it has up to date data for this entry. */
+	bool GetPrecomputedMaterialData(int32 InGlobalIndex, const UUserWidget& EntryWidget, FRadialItemMaterialData& OutMaterialData) const;
+#pragma endregion
+
 	//----------------------------------------------------------------------------------------------
 	// URadialStrategyWidget Functions - Radial Material
 	//----------------------------------------------------------------------------------------------
@@ -234,6 +453,28 @@ protected:
 	 */
 	virtual void ConstructMaterialData(const UUserWidget* EntryWidget, int32 InGlobalIndex, FRadialItemMaterialData& OutMaterialData) const;
 
+	/**
+	 * The math behind ConstructMaterialData, from plain values so it can run on any thread.
+	 * @param EntrySize     The entry widget's desired size (must not be zero).
+	 * @param SlotPosition  The entry's position relative to the layout center.
+	 */
+	static FRadialItemMaterialData ComputeMaterialData(
+		const FVector2D& EntrySize,
+		const FVector2D& SlotPosition,
+		float ItemAngleDeg,
+		float AngularSpacing,
+		float WedgeGapSize,
+		float DistanceFactor,
+		float MinRadius,
+		float MaxRadius
+	);
+
+	/** The material cache for EntryWidget, with its Dispatch resolved. */
+	FRadialEntryMaterialCache& FindOrAddMaterialCache(UUserWidget& EntryWidget);
+
+	/** How EntryWidget takes material data; None if it isn't a radial entry. */
+	EStrategyEntryDispatch GetRadialEntryDispatch(UUserWidget& EntryWidget);
+
 	/** Updates the material data on an entry widget. */
 	virtual void SyncMaterialData(const int32 InGlobalIndex);
 #pragma endregion
@@ -0,0 +1,137 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Benchmarks/StrategyBenchmarkAllocationCounter.h"
+
+#include <HAL/MemoryBase.h>
+
+namespace StrategyBenchmarkAllocationCounter
+{
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		// Only touched on the game thread
+		bool bIsCounting = false;
+		int64 NumAllocations = 0;
+
+		FMalloc* InnerMalloc = nullptr;
+
+		// ~ Begin FMalloc interface
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* MallocZeroed(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->MallocZeroed(Count, Alignment);
+		}
+
+		virtual void* TryMallocZeroed(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMallocZeroed(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// Realloc to 0 is a free
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUsedOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUnusedOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		// ~ End FMalloc interface
+
+	private:
+		void CountAllocation()
+		{
+			// Thread check first, so other threads never read the game thread's state
+			if (IsInGameThread() && bIsCounting)
+			{
+				++NumAllocations;
+			}
+		}
+	};
+
+	static FCountingMalloc* CountingMalloc = nullptr;
+}
+
+void FStrategyBenchmarkAllocationCounter::Begin()
+{
+	using namespace StrategyBenchmarkAllocationCounter;
+	check(IsInGameThread());
+
+	if (!CountingMalloc)
+	{
+		CountingMalloc = new FCountingMalloc(GMalloc);
+	}
+	checkf(!CountingMalloc->bIsCounting, TEXT("Only one FStrategyBenchmarkAllocationCounter can run at a time"));
+
+	// Whatever GMalloc is now (it may have been wrapped since the proxy was made) is what gets forwarded to
+	CountingMalloc->InnerMalloc = GMalloc;
+	CountingMalloc->NumAllocations = 0;
+	CountingMalloc->bIsCounting = true;
+	GMalloc = CountingMalloc;
+}
+
+int64 FStrategyBenchmarkAllocationCounter::End()
+{
+	using namespace StrategyBenchmarkAllocationCounter;
+	check(IsInGameThread());
+
+	if (!CountingMalloc || !CountingMalloc->bIsCounting)
+	{
+		return 0;
+	}
+
+	CountingMalloc->bIsCounting = false;
+	if (GMalloc == CountingMalloc)
+	{
+		GMalloc = CountingMalloc->InnerMalloc;
+	}
+	return CountingMalloc->NumAllocations;
+}
+
+int64 FStrategyBenchmarkAllocationCounter::GetNumAllocations()
+{
+	using namespace StrategyBenchmarkAllocationCounter;
+	return CountingMalloc ? CountingMalloc->NumAllocations : 0;
+}
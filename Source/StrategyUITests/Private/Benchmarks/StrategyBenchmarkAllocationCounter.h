@@ -0,0 +1,26 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+/**
+ * Counts heap allocations made on the game thread while it's running, by putting a forwarding FMalloc in front of
+ * GMalloc. Everything that goes through FMemory (containers, FString, new/delete of UObjects and Slate widgets) counts;
+ * worker threads don't, and neither does memory allocated straight from the OS.
+ *
+ * One counter at a time. The proxy is installed on the first Begin() and never destroyed, since other threads may
+ * still be inside it when GMalloc is handed back.
+ */
+class FStrategyBenchmarkAllocationCounter
+{
+public:
+	/** Installs the proxy (if needed) and starts counting from zero. */
+	static void Begin();
+
+	/** Stops counting and restores GMalloc, returns the number of allocations since Begin(). */
+	static int64 End();
+
+	/** Allocations since Begin(), while counting. */
+	static int64 GetNumAllocations();
+};
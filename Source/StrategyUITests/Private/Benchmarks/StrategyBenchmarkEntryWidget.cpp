@@ -0,0 +1,25 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Benchmarks/StrategyBenchmarkEntryWidget.h"
+
+#include <Blueprint/WidgetTree.h>
+#include <Components/Image.h>
+#include <Components/SizeBox.h>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyBenchmarkEntryWidget)
+
+const FVector2D UStrategyBenchmarkEntryWidget::EntrySize(64.f, 64.f);
+
+TSharedRef<SWidget> UStrategyBenchmarkEntryWidget::RebuildWidget()
+{
+	// Built once per instance; pooled entries keep their tree
+	if (WidgetTree && !WidgetTree->RootWidget)
+	{
+		USizeBox* SizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("EntrySizeBox"));
+		SizeBox->SetWidthOverride(EntrySize.X);
+		SizeBox->SetHeightOverride(EntrySize.Y);
+		SizeBox->AddChild(WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("EntryImage")));
+		WidgetTree->RootWidget = SizeBox;
+	}
+	return Super::RebuildWidget();
+}
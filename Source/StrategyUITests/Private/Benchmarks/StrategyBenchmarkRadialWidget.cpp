@@ -0,0 +1,75 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Benchmarks/StrategyBenchmarkRadialWidget.h"
+
+#include <Strategies/RadialLayoutStrategy.h>
+#include <Widgets/SStrategyCanvasPanel.h>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyBenchmarkRadialWidget)
+
+void UStrategyBenchmarkRadialWidget::InitializeBenchmark(const TSubclassOf<URadialLayoutStrategy> StrategyClass, UObject* InDataProvider, const TSubclassOf<UUserWidget> EntryClass)
+{
+	ensureMsgf(!StrategyCanvasPanel.IsValid(), TEXT("%hs must be called before the Slate widget is built"), __FUNCTION__);
+
+	// Assigned directly rather than through SetLayoutStrategy, which would update the (not yet built) panel
+	LayoutStrategy = NewObject<URadialLayoutStrategy>(this, StrategyClass);
+	DefaultEntryWidgetClass = EntryClass;
+	BenchmarkDataProvider = InDataProvider;
+}
+
+void UStrategyBenchmarkRadialWidget::SimulateFrame(const float RotationDegrees, const float DeltaSeconds, const FVector2D& AllottedSize)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!StrategyCanvasPanel.IsValid())
+	{
+		return;
+	}
+
+	const FGeometry AllottedGeometry = FGeometry::MakeRoot(AllottedSize, FSlateLayoutTransform());
+
+	// What NativePaint would record, nothing paints headlessly
+	if (CachedSize != AllottedSize)
+	{
+		CachedSize = AllottedSize;
+		Center = CachedSize * 0.5f;
+		MarkDirty(ERadialWidgetDirtyFlags::Geometry);
+	}
+
+	// HandleStickInput scales by the world's delta time, which nothing advances here, so the rotation is applied as-is
+	if (RotationDegrees != 0.f)
+	{
+		PendingInputRotationDegrees += RotationDegrees;
+		ApplyManualRotation(RotationDegrees);
+	}
+
+	// Slate skips the tick while the widget sleeps
+	if (!bIsSleeping)
+	{
+		NativeTick(AllottedGeometry, DeltaSeconds);
+	}
+
+	// Sorts by depth and prepasses entering entries, like the arrange before a paint
+	ArrangedChildrenScratch.GetInternalArray().Reset();
+	StrategyCanvasPanel->ArrangeChildren(AllottedGeometry, ArrangedChildrenScratch);
+	ArrangedChildrenScratch.GetInternalArray().Reset();
+}
+
+float UStrategyBenchmarkRadialWidget::GetAngularSpacing() const
+{
+	return LayoutStrategy ? GetLayoutStrategyChecked<URadialLayoutStrategy>().GetAngularSpacing() : 0.f;
+}
+
+void UStrategyBenchmarkRadialWidget::ShutdownBenchmark()
+{
+	Reset();
+	BenchmarkDataProvider = nullptr;
+}
+
+void UStrategyBenchmarkRadialWidget::TryCreateDefaultDataProvider()
+{
+	if (BenchmarkDataProvider && !DataProvider)
+	{
+		SetDataProvider(BenchmarkDataProvider);
+	}
+}
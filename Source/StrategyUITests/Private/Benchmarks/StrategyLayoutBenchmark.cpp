@@ -0,0 +1,428 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "Benchmarks/StrategyLayoutBenchmark.h"
+
+#include <Engine/Engine.h>
+#include <Engine/GameInstance.h>
+#include <Engine/World.h>
+#include <HAL/IConsoleManager.h>
+#include <Misc/DateTime.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+
+#include <Interfaces/IStrategyDataProvider.h>
+#include <Providers/DebugItemsDataProvider.h>
+#include <Utils/LogStrategyUI.h>
+#include <ExampleStrategies/SpiralLayoutStrategy.h>
+#include <ExampleStrategies/WheelLayoutStrategy.h>
+
+#include "Benchmarks/StrategyBenchmarkAllocationCounter.h"
+#include "Benchmarks/StrategyBenchmarkEntryWidget.h"
+#include "Benchmarks/StrategyBenchmarkRadialWidget.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StrategyLayoutBenchmark)
+
+namespace StrategyLayoutBenchmark
+{
+	static const int32 ItemCounts[] = { 8, 64, 256, 10000 };
+
+	// Frames run before measuring, so first-use allocations (entry widgets, pools, position tables) don't count
+	static constexpr int32 NumWarmUpFrames = 60;
+
+	// Simulated frame rate for the pointer velocity
+	static constexpr float SimulatedDeltaSeconds = 1.f / 60.f;
+
+	// StickSpin: how fast the pointer turns
+	static constexpr float SpinDegreesPerSecond = 270.f;
+
+	// FocusSteps: frames between two steps of one item
+	static constexpr int32 FramesPerFocusStep = 6;
+
+	static const FVector2D PanelSize(1920.f, 1080.f);
+
+	static TAutoConsoleVariable<float> CVarMaxAvgFrameMs(
+		TEXT("StrategyUI.Benchmark.MaxAvgFrameMs"),
+		0.5f,
+		TEXT("Average ms per simulated frame above which a StrategyUI benchmark scenario fails (0 = no limit).")
+	);
+
+	static TAutoConsoleVariable<float> CVarMaxP95FrameMs(
+		TEXT("StrategyUI.Benchmark.MaxP95FrameMs"),
+		1.f,
+		TEXT("95th percentile ms per simulated frame above which a StrategyUI benchmark scenario fails (0 = no limit).")
+	);
+
+	static TAutoConsoleVariable<float> CVarMaxAvgAllocationsPerFrame(
+		TEXT("StrategyUI.Benchmark.MaxAvgAllocationsPerFrame"),
+		0.f,
+		TEXT("Average game thread heap allocations per measured frame above which a StrategyUI benchmark scenario fails (negative = no limit).")
+	);
+
+	static TAutoConsoleVariable<float> CVarRegressionTolerance(
+		TEXT("StrategyUI.Benchmark.RegressionTolerance"),
+		0.25f,
+		TEXT("How much slower (0.25 = 25%) than its baseline a StrategyUI benchmark scenario may get before it fails.")
+	);
+
+	static FAutoConsoleCommand RunCommand(
+		TEXT("StrategyUI.Benchmark"),
+		TEXT("Benchmarks a radial strategy widget with the example strategies headlessly and writes the results to a CSV. ")
+		TEXT("Usage: StrategyUI.Benchmark [Frames=600] [Baseline=<path to a previous results csv>]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			int32 NumFrames = 600;
+			FString BaselineCsvPath;
+			for (const FString& Arg : Args)
+			{
+				FParse::Value(*Arg, TEXT("Frames="), NumFrames);
+				FParse::Value(*Arg, TEXT("Baseline="), BaselineCsvPath);
+			}
+
+			const TArray<FStrategyBenchmarkResult> Results = UStrategyLayoutBenchmark::RunBenchmarks(NumFrames, BaselineCsvPath);
+			const FString CsvPath = UStrategyLayoutBenchmark::MakeDefaultCsvPath();
+			UStrategyLayoutBenchmark::WriteResultsCsv(Results, CsvPath);
+
+			const int32 NumFailed = Results.FilterByPredicate([](const FStrategyBenchmarkResult& Result) { return !Result.bPassed; }).Num();
+			if (NumFailed > 0)
+			{
+				UE_LOG(LogStrategyUI, Error, TEXT("StrategyUI.Benchmark: %d of %d scenarios failed, see %s"), NumFailed, Results.Num(), *CsvPath);
+			}
+			else
+			{
+				UE_LOG(LogStrategyUI, Display, TEXT("StrategyUI.Benchmark: all %d scenarios passed, see %s"), Results.Num(), *CsvPath);
+			}
+		})
+	);
+
+	static const TCHAR* LexInput(const EStrategyBenchmarkInput Input)
+	{
+		switch (Input)
+		{
+		case EStrategyBenchmarkInput::StickSpin:  return TEXT("StickSpin");
+		case EStrategyBenchmarkInput::FocusSteps: return TEXT("FocusSteps");
+		}
+		return TEXT("Unknown");
+	}
+
+	// Quotes a CSV field, doubling embedded quotes. Line breaks become spaces so every row stays on one line.
+	static FString EscapeCsvField(const FString& Field)
+	{
+		FString Escaped = Field.Replace(TEXT("\""), TEXT("\"\""));
+		Escaped.ReplaceCharInline(TEXT('\r'), TEXT(' '));
+		Escaped.ReplaceCharInline(TEXT('\n'), TEXT(' '));
+		return FString::Printf(TEXT("\"%s\""), *Escaped);
+	}
+
+	// Splits a line written by WriteResultsCsv into its fields, unquoting quoted ones
+	static void ParseCsvLine(const FString& Line, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+		FString Field;
+		bool bInQuotes = false;
+		for (int32 i = 0; i < Line.Len(); ++i)
+		{
+			const TCHAR Char = Line[i];
+			if (bInQuotes)
+			{
+				if (Char != TEXT('"'))
+				{
+					Field.AppendChar(Char);
+				}
+				else if (i + 1 < Line.Len() && Line[i + 1] == TEXT('"'))
+				{
+					Field.AppendChar(TEXT('"'));
+					++i;
+				}
+				else
+				{
+					bInQuotes = false;
+				}
+			}
+			else if (Char == TEXT('"'))
+			{
+				bInQuotes = true;
+			}
+			else if (Char == TEXT(','))
+			{
+				OutFields.Add(MoveTemp(Field));
+				Field.Reset();
+			}
+			else
+			{
+				Field.AppendChar(Char);
+			}
+		}
+		OutFields.Add(MoveTemp(Field));
+	}
+}
+
+FString FStrategyBenchmarkResult::GetScenarioKey() const
+{
+	return FString::Printf(TEXT("%s/%s/%d"), *StrategyName, StrategyLayoutBenchmark::LexInput(Input), NumItems);
+}
+
+TArray<FStrategyBenchmarkResult> UStrategyLayoutBenchmark::RunBenchmarks(const int32 NumFrames, const FString& BaselineCsvPath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TArray<FStrategyBenchmarkResult> Results;
+	if (!GEngine)
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("%hs: Needs an engine to create the benchmark's game instance"), __FUNCTION__);
+		return Results;
+	}
+
+	const TMap<FString, float> BaselineAvgFrameMs = BaselineCsvPath.IsEmpty() ? TMap<FString, float>() : LoadBaselineCsv(BaselineCsvPath);
+
+	// A game instance of our own gives the widgets a world and the entry pool / widget loader subsystems
+	UStrategyLayoutBenchmark* Benchmark = NewObject<UStrategyLayoutBenchmark>(GetTransientPackage());
+	Benchmark->GameInstance = NewObject<UGameInstance>(GEngine);
+	Benchmark->GameInstance->InitializeStandalone(TEXT("StrategyUIBenchmark"));
+
+	const TSubclassOf<URadialLayoutStrategy> StrategyClasses[] = { UWheelLayoutStrategy::StaticClass(), USpiralLayoutStrategy::StaticClass() };
+	const EStrategyBenchmarkInput Inputs[] = { EStrategyBenchmarkInput::StickSpin, EStrategyBenchmarkInput::FocusSteps };
+
+	for (const TSubclassOf<URadialLayoutStrategy>& StrategyClass : StrategyClasses)
+	{
+		for (const int32 NumItems : StrategyLayoutBenchmark::ItemCounts)
+		{
+			for (const EStrategyBenchmarkInput Input : Inputs)
+			{
+				FStrategyBenchmarkResult& Result = Results.Add_GetRef(Benchmark->RunScenario(StrategyClass, NumItems, Input, FMath::Max(NumFrames, 1)));
+				CheckThresholds(Result, BaselineAvgFrameMs);
+
+				UE_LOG(
+					LogStrategyUI,
+					Display,
+					TEXT("%hs: %s avg %.4f ms, p95 %.4f ms, max %.4f ms, %.2f allocs/frame (max %d), %d widgets created (peak %d slots)%s%s"),
+					__FUNCTION__,
+					*Result.GetScenarioKey(),
+					Result.AvgFrameMs,
+					Result.P95FrameMs,
+					Result.MaxFrameMs,
+					Result.AvgAllocationsPerFrame,
+					Result.MaxFrameAllocations,
+					Result.NumWidgetsCreated,
+					Result.PeakLiveSlots,
+					Result.bPassed ? TEXT("") : TEXT(" -- FAILED: "),
+					*Result.FailureReason
+				);
+			}
+		}
+	}
+
+	UWorld* World = Benchmark->GameInstance->GetWorld();
+	Benchmark->GameInstance->Shutdown();
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(/*bInformEngineOfWorld=*/ false);
+	}
+	Benchmark->GameInstance->MarkAsGarbage();
+	Benchmark->GameInstance = nullptr;
+	Benchmark->MarkAsGarbage();
+	return Results;
+}
+
+FStrategyBenchmarkResult UStrategyLayoutBenchmark::RunScenario(const TSubclassOf<URadialLayoutStrategy> StrategyClass, const int32 InNumItems, const EStrategyBenchmarkInput Input, const int32 NumFrames)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	FStrategyBenchmarkResult Result;
+	Result.StrategyName = StrategyClass->GetName();
+	Result.Input = Input;
+	Result.NumItems = InNumItems;
+	Result.NumFrames = NumFrames;
+
+	UDebugItemsDataProvider* DataProvider = NewObject<UDebugItemsDataProvider>(GameInstance);
+	DataProvider->DebugItemCount = InNumItems;
+
+	UStrategyBenchmarkRadialWidget* Widget = CreateWidget<UStrategyBenchmarkRadialWidget>(GameInstance, UStrategyBenchmarkRadialWidget::StaticClass());
+	Widget->InitializeBenchmark(StrategyClass, DataProvider, UStrategyBenchmarkEntryWidget::StaticClass());
+
+	// Builds the canvas panel and runs NativeConstruct, which binds the provider and lays out the first window
+	TSharedPtr<SWidget> SlateWidget = Widget->TakeWidget();
+
+	for (int32 FrameIndex = 0; FrameIndex < StrategyLayoutBenchmark::NumWarmUpFrames; ++FrameIndex)
+	{
+		TickFrame(*Widget, Input, FrameIndex);
+	}
+
+	// The widget's frame stats accumulate until GFrameCounter moves on, which it doesn't while we run, so the measured
+	// frames are whatever they add on top of the warm-up
+	const FStrategyWidgetFrameStats StatsBefore = Widget->GetLastFrameStats();
+
+	TArray<double> FrameMs;
+	FrameMs.Reserve(NumFrames);
+	int64 TotalAllocations = 0;
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		FStrategyBenchmarkAllocationCounter::Begin();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		TickFrame(*Widget, Input, StrategyLayoutBenchmark::NumWarmUpFrames + FrameIndex);
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		const int64 FrameAllocations = FStrategyBenchmarkAllocationCounter::End();
+
+		FrameMs.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles));
+		TotalAllocations += FrameAllocations;
+		Result.MaxFrameAllocations = FMath::Max(Result.MaxFrameAllocations, static_cast<int32>(FrameAllocations));
+		Result.PeakLiveSlots = FMath::Max(Result.PeakLiveSlots, Widget->GetLastFrameStats().NumLiveSlots);
+	}
+
+	const FStrategyWidgetFrameStats& StatsAfter = Widget->GetLastFrameStats();
+	if (ensureMsgf(StatsAfter.FrameNumber == StatsBefore.FrameNumber, TEXT("%hs: The frame moved on mid-scenario, entry counts are incomplete"), __FUNCTION__))
+	{
+		Result.NumEntriesAcquired = StatsAfter.NumAcquires - StatsBefore.NumAcquires;
+		Result.NumEntriesReleased = StatsAfter.NumReleases - StatsBefore.NumReleases;
+		Result.NumWidgetsCreated = Result.NumEntriesAcquired - (StatsAfter.NumPoolHits - StatsBefore.NumPoolHits);
+	}
+
+	double TotalMs = 0.0;
+	for (const double Ms : FrameMs)
+	{
+		TotalMs += Ms;
+	}
+	FrameMs.Sort();
+	Result.AvgFrameMs = static_cast<float>(TotalMs / NumFrames);
+	Result.P95FrameMs = static_cast<float>(FrameMs[FMath::Min(FMath::FloorToInt32(NumFrames * 0.95), NumFrames - 1)]);
+	Result.MaxFrameMs = static_cast<float>(FrameMs.Last());
+	Result.AvgAllocationsPerFrame = static_cast<float>(static_cast<double>(TotalAllocations) / NumFrames);
+
+	// Entries go back to the shared pool, where the next scenario picks them up
+	Widget->ShutdownBenchmark();
+	SlateWidget.Reset();
+	Widget->ReleaseSlateResources(/*bReleaseChildren=*/ true);
+	Widget->MarkAsGarbage();
+	DataProvider->MarkAsGarbage();
+
+	return Result;
+}
+
+void UStrategyLayoutBenchmark::TickFrame(UStrategyBenchmarkRadialWidget& Widget, const EStrategyBenchmarkInput Input, const int32 FrameIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	float RotationDegrees = 0.f;
+	switch (Input)
+	{
+	case EStrategyBenchmarkInput::StickSpin:
+		RotationDegrees = StrategyLayoutBenchmark::SpinDegreesPerSecond * StrategyLayoutBenchmark::SimulatedDeltaSeconds;
+		break;
+	case EStrategyBenchmarkInput::FocusSteps:
+		if (FrameIndex % StrategyLayoutBenchmark::FramesPerFocusStep == 0)
+		{
+			RotationDegrees = Widget.GetAngularSpacing();
+		}
+		break;
+	}
+
+	Widget.SimulateFrame(RotationDegrees, StrategyLayoutBenchmark::SimulatedDeltaSeconds, StrategyLayoutBenchmark::PanelSize);
+}
+
+void UStrategyLayoutBenchmark::CheckThresholds(FStrategyBenchmarkResult& Result, const TMap<FString, float>& BaselineAvgFrameMs)
+{
+	TArray<FString> Failures;
+
+	const float MaxAvgFrameMs = StrategyLayoutBenchmark::CVarMaxAvgFrameMs.GetValueOnGameThread();
+	if (MaxAvgFrameMs > 0.f && Result.AvgFrameMs > MaxAvgFrameMs)
+	{
+		Failures.Add(FString::Printf(TEXT("avg %.4f ms > %.4f ms"), Result.AvgFrameMs, MaxAvgFrameMs));
+	}
+
+	const float MaxP95FrameMs = StrategyLayoutBenchmark::CVarMaxP95FrameMs.GetValueOnGameThread();
+	if (MaxP95FrameMs > 0.f && Result.P95FrameMs > MaxP95FrameMs)
+	{
+		Failures.Add(FString::Printf(TEXT("p95 %.4f ms > %.4f ms"), Result.P95FrameMs, MaxP95FrameMs));
+	}
+
+	const float MaxAvgAllocationsPerFrame = StrategyLayoutBenchmark::CVarMaxAvgAllocationsPerFrame.GetValueOnGameThread();
+	if (MaxAvgAllocationsPerFrame >= 0.f && Result.AvgAllocationsPerFrame > MaxAvgAllocationsPerFrame)
+	{
+		Failures.Add(FString::Printf(TEXT("%.2f allocations per frame > %.2f (max %d in one frame)"), Result.AvgAllocationsPerFrame, MaxAvgAllocationsPerFrame, Result.MaxFrameAllocations));
+	}
+
+	// Once warm, the entry pool should cover every entry entering the window
+	if (Result.NumWidgetsCreated > 0)
+	{
+		Failures.Add(FString::Printf(TEXT("%d widgets created after warm-up"), Result.NumWidgetsCreated));
+	}
+
+	if (const float* BaselineMs = BaselineAvgFrameMs.Find(Result.GetScenarioKey()))
+	{
+		Result.BaselineAvgFrameMs = *BaselineMs;
+		const float MaxMs = *BaselineMs * (1.f + StrategyLayoutBenchmark::CVarRegressionTolerance.GetValueOnGameThread());
+		if (*BaselineMs > 0.f && Result.AvgFrameMs > MaxMs)
+		{
+			Failures.Add(FString::Printf(TEXT("avg %.4f ms regressed from baseline %.4f ms"), Result.AvgFrameMs, *BaselineMs));
+		}
+	}
+
+	Result.bPassed = Failures.IsEmpty();
+	Result.FailureReason = FString::Join(Failures, TEXT("; "));
+}
+
+bool UStrategyLayoutBenchmark::WriteResultsCsv(const TArray<FStrategyBenchmarkResult>& Results, const FString& CsvPath)
+{
+	using namespace StrategyLayoutBenchmark;
+
+	FString Csv = TEXT("Scenario,Strategy,Input,NumItems,NumFrames,AvgFrameMs,P95FrameMs,MaxFrameMs,AvgAllocationsPerFrame,MaxFrameAllocations,NumWidgetsCreated,PeakLiveSlots,NumEntriesAcquired,NumEntriesReleased,BaselineAvgFrameMs,Passed,FailureReason\n");
+	for (const FStrategyBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(
+			TEXT("%s,%s,%s,%d,%d,%.5f,%.5f,%.5f,%.3f,%d,%d,%d,%d,%d,%.5f,%s,%s\n"),
+			*EscapeCsvField(Result.GetScenarioKey()),
+			*EscapeCsvField(Result.StrategyName),
+			LexInput(Result.Input),
+			Result.NumItems,
+			Result.NumFrames,
+			Result.AvgFrameMs,
+			Result.P95FrameMs,
+			Result.MaxFrameMs,
+			Result.AvgAllocationsPerFrame,
+			Result.MaxFrameAllocations,
+			Result.NumWidgetsCreated,
+			Result.PeakLiveSlots,
+			Result.NumEntriesAcquired,
+			Result.NumEntriesReleased,
+			Result.BaselineAvgFrameMs,
+			Result.bPassed ? TEXT("true") : TEXT("false"),
+			*EscapeCsvField(Result.FailureReason)
+		);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogStrategyUI, Error, TEXT("%hs: Failed to write %s"), __FUNCTION__, *CsvPath);
+		return false;
+	}
+	return true;
+}
+
+FString UStrategyLayoutBenchmark::MakeDefaultCsvPath()
+{
+	return FPaths::Combine(FPaths::ProfilingDir(), TEXT("StrategyUI"), FString::Printf(TEXT("StrategyUIBenchmark-%s.csv"), *FDateTime::Now().ToString()));
+}
+
+TMap<FString, float> UStrategyLayoutBenchmark::LoadBaselineCsv(const FString& CsvPath)
+{
+	TMap<FString, float> BaselineAvgFrameMs;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *CsvPath))
+	{
+		UE_LOG(LogStrategyUI, Warning, TEXT("%hs: Failed to read baseline %s, only the absolute thresholds apply"), __FUNCTION__, *CsvPath);
+		return BaselineAvgFrameMs;
+	}
+
+	// Scenario is the first column and AvgFrameMs the sixth (see WriteResultsCsv), the header line is skipped
+	TArray<FString> Columns;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		StrategyLayoutBenchmark::ParseCsvLine(Lines[LineIndex], Columns);
+		if (Columns.Num() > 5)
+		{
+			BaselineAvgFrameMs.Add(Columns[0], FCString::Atof(*Columns[5]));
+		}
+	}
+	return BaselineAvgFrameMs;
+}
@@ -0,0 +1,19 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include "StrategyUITests.h"
+
+#define LOCTEXT_NAMESPACE "FStrategyUITestsModule"
+
+void FStrategyUITestsModule::StartupModule()
+{
+    
+}
+
+void FStrategyUITestsModule::ShutdownModule()
+{
+    
+}
+
+#undef LOCTEXT_NAMESPACE
+    
+IMPLEMENT_MODULE(FStrategyUITestsModule, StrategyUITests)
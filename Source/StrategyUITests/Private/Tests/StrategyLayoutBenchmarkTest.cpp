@@ -0,0 +1,61 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#include <HAL/IConsoleManager.h>
+#include <Misc/AutomationTest.h>
+
+#include "Benchmarks/StrategyLayoutBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StrategyLayoutBenchmarkTest
+{
+	static TAutoConsoleVariable<int32> CVarFrames(
+		TEXT("StrategyUI.Benchmark.Test.Frames"),
+		600,
+		TEXT("Measured frames per scenario in the StrategyUI.Benchmark.RadialLayouts automation test.")
+	);
+
+	static TAutoConsoleVariable<FString> CVarBaselineCsv(
+		TEXT("StrategyUI.Benchmark.Test.BaselineCsv"),
+		TEXT(""),
+		TEXT("Results CSV of a previous run for the StrategyUI.Benchmark.RadialLayouts automation test to check regressions against (empty = thresholds only).")
+	);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FStrategyLayoutBenchmarkTest,
+	"StrategyUI.Benchmark.RadialLayouts",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter
+)
+
+bool FStrategyLayoutBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const TArray<FStrategyBenchmarkResult> Results = UStrategyLayoutBenchmark::RunBenchmarks(
+		StrategyLayoutBenchmarkTest::CVarFrames.GetValueOnGameThread(),
+		StrategyLayoutBenchmarkTest::CVarBaselineCsv.GetValueOnGameThread()
+	);
+	if (!TestTrue(TEXT("Ran at least one scenario"), Results.Num() > 0))
+	{
+		return false;
+	}
+
+	// Kept next to the automation report, so the next run can use it as its baseline
+	const FString CsvPath = UStrategyLayoutBenchmark::MakeDefaultCsvPath();
+	UStrategyLayoutBenchmark::WriteResultsCsv(Results, CsvPath);
+	AddInfo(FString::Printf(TEXT("Results written to %s"), *CsvPath));
+
+	for (const FStrategyBenchmarkResult& Result : Results)
+	{
+		if (Result.bPassed)
+		{
+			AddInfo(FString::Printf(TEXT("%s: avg %.4f ms, %.2f allocations per frame"), *Result.GetScenarioKey(), Result.AvgFrameMs, Result.AvgAllocationsPerFrame));
+		}
+		else
+		{
+			AddError(FString::Printf(TEXT("%s: %s"), *Result.GetScenarioKey(), *Result.FailureReason));
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,26 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <ExampleWidgets/RadialEntryWidgetBase.h>
+
+#include "StrategyBenchmarkEntryWidget.generated.h"
+
+/**
+ * Native radial entry for UStrategyLayoutBenchmark: a fixed size box around an image, built in code since there's no
+ * designer tree. Goes through the same native entry hooks as any URadialEntryWidgetBase.
+ */
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class STRATEGYUITESTS_API UStrategyBenchmarkEntryWidget : public URadialEntryWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Desired size of every entry. */
+	static const FVector2D EntrySize;
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+};
@@ -0,0 +1,50 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Layout/ArrangedChildren.h>
+
+#include <ExampleWidgets/RadialStrategyWidget.h>
+
+#include "StrategyBenchmarkRadialWidget.generated.h"
+
+/**
+ * URadialStrategyWidget that UStrategyLayoutBenchmark drives headlessly. Everything from input to arranging the canvas
+ * panel runs through the regular widget code; this only stands in for the Slate application around it (ticking, the
+ * allotted geometry paint would record, and the arrange pass).
+ */
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class STRATEGYUITESTS_API UStrategyBenchmarkRadialWidget : public URadialStrategyWidget
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Lays out InDataProvider's items with a new StrategyClass strategy and EntryClass entries.
+	 * Call before the Slate widget is built; the provider is bound on construct, like DefaultDataProviderClass.
+	 */
+	void InitializeBenchmark(TSubclassOf<URadialLayoutStrategy> StrategyClass, UObject* InDataProvider, TSubclassOf<UUserWidget> EntryClass);
+
+	/**
+	 * Runs one frame: applies RotationDegrees of pointer input (queued like HandleStickInput does), ticks the widget
+	 * and arranges the canvas panel at AllottedSize.
+	 */
+	void SimulateFrame(float RotationDegrees, float DeltaSeconds, const FVector2D& AllottedSize);
+
+	/** Angle between two items, i.e. one focus step. */
+	float GetAngularSpacing() const;
+
+	/** Releases everything the widget holds; entries go back to the shared pool. */
+	void ShutdownBenchmark();
+
+protected:
+	virtual void TryCreateDefaultDataProvider() override;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UObject> BenchmarkDataProvider = nullptr;
+
+	// Kept between frames like the panel's own paint scratch
+	FArrangedChildren ArrangedChildrenScratch{ EVisibility::Visible };
+};
@@ -0,0 +1,134 @@
+﻿// Copyright Mike Desrosiers 2025, All Rights Reserved.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/Object.h>
+
+#include "StrategyLayoutBenchmark.generated.h"
+
+class UGameInstance;
+class URadialLayoutStrategy;
+class UStrategyBenchmarkRadialWidget;
+
+/** How a benchmark scenario drives the layout's pointer. */
+UENUM(BlueprintType)
+enum class EStrategyBenchmarkInput : uint8
+{
+	/** A stick held to the side: the pointer keeps turning at a steady rate. */
+	StickSpin,
+	/** D-pad style taps: the pointer jumps one item every few frames. */
+	FocusSteps,
+};
+
+/** Measurements of one benchmark scenario (one strategy class, item count and input). */
+USTRUCT(BlueprintType)
+struct STRATEGYUITESTS_API FStrategyBenchmarkResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	FString StrategyName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	EStrategyBenchmarkInput Input = EStrategyBenchmarkInput::StickSpin;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 NumItems = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 NumFrames = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark", meta=(Units="ms"))
+	float AvgFrameMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark", meta=(Units="ms"))
+	float P95FrameMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark", meta=(Units="ms"))
+	float MaxFrameMs = 0.f;
+
+	/** Game thread heap allocations per measured frame, on average. Steady state should be 0. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	float AvgAllocationsPerFrame = 0.f;
+
+	/** Most game thread heap allocations in a single measured frame. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 MaxFrameAllocations = 0;
+
+	/** Entry widgets that had to be created because the shared entry pool had none free. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 NumWidgetsCreated = 0;
+
+	/** Most live entry slots the widget held at once. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 PeakLiveSlots = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 NumEntriesAcquired = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	int32 NumEntriesReleased = 0;
+
+	/** AvgFrameMs of the same scenario in the baseline CSV, or 0 without one. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark", meta=(Units="ms"))
+	float BaselineAvgFrameMs = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	bool bPassed = true;
+
+	/** Why the thresholds failed, empty if bPassed. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="StrategyUI|Benchmark")
+	FString FailureReason;
+
+	/** Identifies the scenario across runs, e.g. "WheelLayoutStrategy/StickSpin/256". */
+	FString GetScenarioKey() const;
+};
+
+/**
+ * Headless benchmark of URadialStrategyWidget with the example wheel and spiral strategies.
+ *
+ * Every scenario builds a real radial strategy widget (UStrategyBenchmarkRadialWidget) with native entries, fed by a
+ * UDebugItemsDataProvider scaled to 8, 64, 256 and 10k items, under its own game instance so entries recycle through
+ * the shared UStrategyEntryPoolSubsystem. Simulated stick spins or focus steps then run through the widget's own frame:
+ * input, UpdateWidgets, entry acquire/release, RebuildSlateForIndices and the canvas panel arrange.
+ *
+ * Per frame it records ms, game thread heap allocations (counted by a malloc hook around the measured frames) and
+ * entry widget creations. Results go to a CSV and are checked against the StrategyUI.Benchmark.* thresholds and,
+ * optionally, a baseline CSV from a previous run, to catch regressions when pulling in new plugin versions.
+ *
+ * Runs as the StrategyUI.Benchmark.RadialLayouts automation test (for CI), or by hand with
+ * `StrategyUI.Benchmark [Frames=600] [Baseline=<path to csv>]`.
+ */
+UCLASS(Transient)
+class STRATEGYUITESTS_API UStrategyLayoutBenchmark : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Runs every scenario for NumFrames measured frames each, checking them against BaselineCsvPath if it exists. */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|Benchmark")
+	static TArray<FStrategyBenchmarkResult> RunBenchmarks(int32 NumFrames = 600, const FString& BaselineCsvPath = TEXT(""));
+
+	/** Writes Results as CSV (the format RunBenchmarks reads baselines from). */
+	UFUNCTION(BlueprintCallable, Category="StrategyUI|Benchmark")
+	static bool WriteResultsCsv(const TArray<FStrategyBenchmarkResult>& Results, const FString& CsvPath);
+
+	/** Where results are written by default: <Saved>/Profiling/StrategyUI/StrategyUIBenchmark-<timestamp>.csv */
+	static FString MakeDefaultCsvPath();
+
+private:
+	FStrategyBenchmarkResult RunScenario(TSubclassOf<URadialLayoutStrategy> StrategyClass, int32 InNumItems, EStrategyBenchmarkInput Input, int32 NumFrames);
+
+	/** Runs one simulated frame of Widget for Input. */
+	static void TickFrame(UStrategyBenchmarkRadialWidget& Widget, EStrategyBenchmarkInput Input, int32 FrameIndex);
+
+	/** Applies the thresholds (and the baseline, if any) to Result. */
+	static void CheckThresholds(FStrategyBenchmarkResult& Result, const TMap<FString, float>& BaselineAvgFrameMs);
+
+	static TMap<FString, float> LoadBaselineCsv(const FString& CsvPath);
+
+	/** Owns the world, entry pool and widget loader the scenarios run in. */
+	UPROPERTY(Transient)
+	TObjectPtr<UGameInstance> GameInstance = nullptr;
+};
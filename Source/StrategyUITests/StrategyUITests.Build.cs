@@ -0,0 +1,29 @@
+﻿using UnrealBuildTool;
+
+public class StrategyUITests : ModuleRules
+{
+	public StrategyUITests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"StrategyUI",
+				"StrategyUIExamples",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"Slate",
+				"SlateCore",
+				"UMG",
+			}
+		);
+	}
+}